@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <string_view>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+constexpr std::size_t EXPRESSION_DEPTH = 8;
+
+using FunctionParser = std::function<ParserOutput<std::uint32_t>(ParserInput)>;
+
+// sum := term ('+' term)*
+// term := uint32 | '(' sum ')'
+template <typename SumRef>
+auto SumGrammar(const SumRef& sum_ref)
+{
+    const auto term = uint32_parser || (ParseChar('(') >> sum_ref << ParseChar(')'));
+    return Combine(term, Any(ParseChar('+') >> term, std::uint32_t{0}, std::plus<>()), std::plus<>());
+}
+
+template <typename Parser>
+void RunExpressions(benchmark::State& state, const Parser& sum_parser)
+{
+    const auto corpus = bench::corpus::Expressions(state.range(0), EXPRESSION_DEPTH);
+
+    for (auto _ : state)
+    {
+        std::uint32_t total = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = sum_parser(code);
+            if (result.is_some())
+            {
+                total += result.unwrap().first;
+                code = result.unwrap().second;
+            }
+            code.remove_prefix(code.empty() ? 0 : 1);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+}  // namespace
+
+// The recursion goes through a `std::function` and a lambda capturing it.
+static void BM_Recursive_StdFunction(benchmark::State& state)
+{
+    FunctionParser sum;
+    sum = SumGrammar([&sum](ParserInput code) { return sum(code); });
+
+    RunExpressions(state, sum);
+}
+BENCHMARK(BM_Recursive_StdFunction)->Range(1 << 10, 1 << 16);
+
+// The recursion goes through an `AnyParser` and a `ParserRef` to it.
+static void BM_Recursive_AnyParser(benchmark::State& state)
+{
+    AnyParser<std::uint32_t> sum;
+    sum = SumGrammar(ParserRef<std::uint32_t>(sum));
+
+    RunExpressions(state, sum);
+}
+BENCHMARK(BM_Recursive_AnyParser)->Range(1 << 10, 1 << 16);
+
+namespace
+{
+template <typename Parser>
+void RunErasedTokenizer(benchmark::State& state, const Parser& token_parser)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::size_t tokens = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = token_parser(code);
+            tokens += result.is_some();
+            code = result.is_some() ? result.unwrap().second : code.substr(1);
+        }
+        benchmark::DoNotOptimize(tokens);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+}  // namespace
+
+// One erased call per token: the pure call overhead of each erasure.
+static void BM_ErasedCall_StdFunction(benchmark::State& state)
+{
+    const std::function<ParserOutput<std::string_view>(ParserInput)> token_parser = TakeWhile1(alphabet_set);
+
+    RunErasedTokenizer(state, token_parser);
+}
+BENCHMARK(BM_ErasedCall_StdFunction)->Range(1 << 10, 1 << 16);
+
+static void BM_ErasedCall_AnyParser(benchmark::State& state)
+{
+    const AnyParser<std::string_view> token_parser = TakeWhile1(alphabet_set);
+
+    RunErasedTokenizer(state, token_parser);
+}
+BENCHMARK(BM_ErasedCall_AnyParser)->Range(1 << 10, 1 << 16);
+
+// Building the erased parser: `std::function` allocates for closures beyond its small buffer.
+static void BM_ErasedBuild_StdFunction(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::function<ParserOutput<std::string_view>(ParserInput)> token_parser = TakeWhile1(alphabet_set);
+        benchmark::DoNotOptimize(token_parser);
+    }
+}
+BENCHMARK(BM_ErasedBuild_StdFunction);
+
+static void BM_ErasedBuild_AnyParser(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        AnyParser<std::string_view> token_parser = TakeWhile1(alphabet_set);
+        benchmark::DoNotOptimize(token_parser);
+    }
+}
+BENCHMARK(BM_ErasedBuild_AnyParser);
@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+template <typename Parser>
+void RunTokenizer(benchmark::State& state, const Parser& token_parser)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::size_t tokens = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = token_parser(code);
+            if (result.is_some())
+            {
+                tokens += 1;
+                code = result.unwrap().second;
+            }
+            else
+            {
+                code.remove_prefix(1);
+            }
+        }
+        benchmark::DoNotOptimize(tokens);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+}  // namespace
+
+static void BM_Tokenize_ManyStaticString(benchmark::State& state)
+{
+    RunTokenizer(state, Many(alphabet_parser, StaticString<char, 32>(), [](auto acc, char ch) {
+                     acc.push_back(ch);
+                     return acc;
+                 }));
+}
+BENCHMARK(BM_Tokenize_ManyStaticString)->Range(1 << 10, 1 << 20);
+
+static void BM_Tokenize_TakeWhile1(benchmark::State& state)
+{
+    RunTokenizer(state, TakeWhile1(alphabet_set));
+}
+BENCHMARK(BM_Tokenize_TakeWhile1)->Range(1 << 10, 1 << 20);
+
+static void BM_LongSpan_TakeUntil(benchmark::State& state)
+{
+    const auto corpus      = bench::corpus::Identifiers(state.range(0));
+    const auto line_parser = TakeUntil("\n"sv);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(line_parser(corpus));
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_LongSpan_TakeUntil)->Range(1 << 10, 1 << 20);
+
+namespace
+{
+constexpr std::size_t CSTR_CAPACITY = 1 << 16;
+
+template <typename Parser>
+void RunCString(benchmark::State& state, const Parser& parser)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parser(corpus));
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+    state.SetComplexityN(state.range(0));
+}
+}  // namespace
+
+// `acc = fn(acc, ch)`: one whole-capacity copy per byte.
+static void BM_CString_CopyAccumulator(benchmark::State& state)
+{
+    RunCString(state, Many(c_str_chara_parser, StaticString<char, CSTR_CAPACITY>(), [](auto acc, char ch) {
+                   acc.push_back(ch);
+                   return acc;
+               }));
+}
+BENCHMARK(BM_CString_CopyAccumulator)->RangeMultiplier(4)->Range(1 << 6, 1 << 10)->Complexity();
+
+// `fn(acc, ch)` in place: linear in the input length.
+static void BM_CString_InplaceAccumulator(benchmark::State& state)
+{
+    RunCString(state, c_str_parser<CSTR_CAPACITY>);
+}
+BENCHMARK(BM_CString_InplaceAccumulator)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Complexity(benchmark::oN);
+
+namespace
+{
+constexpr std::string_view KEYWORDS[] = {"auto",    "break",  "case",   "char",  "const", "continue",
+                                         "default", "do",     "double", "else",  "enum",  "extern",
+                                         "float",   "for",    "goto",   "if",    "int",   "long",
+                                         "return",  "sizeof", "static", "while", "void",  "switch"};
+
+template <std::size_t... Is>
+constexpr auto KeywordAlternatives(std::index_sequence<Is...>)
+{
+    return (ParseString(KEYWORDS[Is]) || ...);
+}
+
+template <std::size_t... Is>
+constexpr auto KeywordChoice(std::index_sequence<Is...>)
+{
+    return Choice(ParseString(KEYWORDS[Is])...);
+}
+
+template <typename Parser>
+void RunKeywords(benchmark::State& state, const Parser& keyword_parser)
+{
+    const auto corpus = bench::corpus::Words(state.range(0), KEYWORDS);
+
+    for (auto _ : state)
+    {
+        std::size_t keywords = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = keyword_parser(code);
+            if (result.is_some())
+            {
+                keywords += 1;
+                code = result.unwrap().second;
+            }
+            code.remove_prefix(code.empty() ? 0 : 1);
+        }
+        benchmark::DoNotOptimize(keywords);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+}  // namespace
+
+// Every branch of the `||` chain is tried in turn until one matches.
+static void BM_Keyword_Alternatives(benchmark::State& state)
+{
+    RunKeywords(state, KeywordAlternatives(std::make_index_sequence<std::size(KEYWORDS)>{}));
+}
+BENCHMARK(BM_Keyword_Alternatives)->Range(1 << 10, 1 << 16);
+
+// Only the branches whose first byte matches are tried.
+static void BM_Keyword_Choice(benchmark::State& state)
+{
+    RunKeywords(state, KeywordChoice(std::make_index_sequence<std::size(KEYWORDS)>{}));
+}
+BENCHMARK(BM_Keyword_Choice)->Range(1 << 10, 1 << 16);
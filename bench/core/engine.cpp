@@ -0,0 +1,290 @@
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <string_view>
+
+#include "../../inc/parser_demo"
+#include "../../src/fmt/inc/parser.hpp"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+// The monadic combinators as they were before being lowered onto the out-parameter protocol: every step builds an
+// `Option<pair<T, string_view>>`, and `Combine` goes through a temporary tuple. Kept here as the baseline.
+namespace monadic
+{
+using d1::core::parser::__impl::ParsedMirType;
+using d1::core::parser::__impl::ParsedResultType;
+using namespace d1::utils::option::operators;
+
+constexpr auto ParseChar(char ch)
+{
+    return [ch](ParserInput code) -> ParserOutput<char> {
+        return (code.empty() || code[0] != ch) ? NONE : SOME(std::make_pair(ch, code.substr(1)));
+    };
+}
+
+constexpr auto ParseOneOfChars(CharSet set)
+{
+    return [set](ParserInput code) -> ParserOutput<char> {
+        return (code.empty() || !set.contains(code[0])) ? NONE : SOME(std::make_pair(code[0], code.substr(1)));
+    };
+}
+
+template <typename Parser, typename Fn>
+constexpr auto Map(Parser parser, Fn fn)
+{
+    using Mir = ParsedMirType<Parser>;
+    using R   = ParserOutput<std::invoke_result_t<Fn, ParsedResultType<Parser>>>;
+
+    return [=](ParserInput code) -> R {
+        return parser(code) >>= [=](const Mir& mir) -> R { return SOME(std::make_pair(fn(mir.first), mir.second)); };
+    };
+}
+
+template <typename Parser1, typename Parser2, typename Fn>
+constexpr auto Combine(Parser1 parser1, Parser2 parser2, Fn fn)
+{
+    using Mir1 = ParsedMirType<Parser1>;
+    using Mir2 = ParsedMirType<Parser2>;
+    using R    = std::invoke_result_t<Fn, ParsedResultType<Parser1>, ParsedResultType<Parser2>>;
+
+    return [=](ParserInput code) -> ParserOutput<R> {
+        return parser1(code) >>= ([=](const Mir1& mir1) {
+                   return parser2(mir1.second) >>= [r1 = mir1.first](const Mir2& mir2) {
+                       return SOME(std::make_tuple(r1, mir2.first, mir2.second));
+                   };
+               } <<= [=](const auto& tuple1_2) -> ParserOutput<R> {
+                   const auto [r1, r2, code] = tuple1_2;
+                   return SOME(std::make_pair(fn(r1, r2), code));
+               });
+    };
+}
+
+template <typename Parser1, typename Parser2>
+constexpr auto Or(Parser1 parser1, Parser2 parser2)
+{
+    using T = ParsedResultType<Parser1>;
+
+    return [=](ParserInput code) -> ParserOutput<T> {
+        auto mir = parser1(code);
+        if (mir.is_some())
+        {
+            return mir;
+        }
+        return parser2(code);
+    };
+}
+
+template <typename Parser1, typename Parser2>
+constexpr auto Left(Parser1 parser1, Parser2 parser2)
+{
+    return Combine(parser1, parser2, [](const auto& lhs, const auto& rhs) { return lhs; });
+}
+
+template <typename Parser1, typename Parser2>
+constexpr auto Right(Parser1 parser1, Parser2 parser2)
+{
+    return Combine(parser1, parser2, [](const auto& lhs, const auto& rhs) { return rhs; });
+}
+
+template <typename Parser, typename T>
+constexpr auto Try(Parser parser, T default_value)
+{
+    return [=](ParserInput code) -> ParserOutput<T> {
+        auto mir = parser(code);
+        if (mir.is_some())
+        {
+            return mir;
+        }
+        return SOME(std::make_pair(default_value, code));
+    };
+}
+
+template <typename Parser, typename Acc, typename Fn, typename Predicator>
+constexpr auto FoldWhile(const Parser& parser, ParserInput code, Acc acc, const Fn& fn, const Predicator& predicator)
+{
+    while (true)
+    {
+        const auto mir = parser(code);
+        if (mir.is_some() && predicator(acc, mir.unwrap_unchecked().first))
+        {
+            d1::core::combinator::__impl::Accumulate(fn, acc, mir.unwrap_unchecked().first);
+            code = mir.unwrap_unchecked().second;
+        }
+        else
+        {
+            return SOME(std::make_pair(std::move(acc), code));
+        }
+    }
+}
+
+template <typename Parser, typename Acc, typename Fn, typename Predicator>
+constexpr auto DoWhile(Parser parser, Acc acc, Fn fn, Predicator predicator)
+{
+    using Mir = ParsedMirType<Parser>;
+
+    return [=](ParserInput code) -> ParserOutput<Acc> {
+        return parser(code) >>= [&](const Mir& mir) {
+            auto init = acc;
+            d1::core::combinator::__impl::Accumulate(fn, init, mir.first);
+            return FoldWhile(parser, mir.second, std::move(init), fn, predicator);
+        };
+    };
+}
+
+template <typename Parser, typename Acc, typename Fn>
+constexpr auto Many(Parser parser, Acc acc, Fn fn)
+{
+    return DoWhile(parser, acc, fn, [](const auto&, const auto&) { return true; });
+}
+
+constexpr auto digit_parser = Map(ParseOneOfChars(digit_set), [](char ch) { return static_cast<int>(ch - '0'); });
+
+constexpr auto ParseInt32()
+{
+    constexpr std::int32_t INT32_MAX_DIV_10 = std::numeric_limits<std::int32_t>::max() / 10;
+    constexpr std::int32_t INT32_MAX_MOD_10 = std::numeric_limits<std::int32_t>::max() % 10;
+
+    constexpr auto abs_parser = [](std::int32_t limit_dig) {
+        return DoWhile(
+            digit_parser, static_cast<std::uint32_t>(0), [](std::uint32_t acc, int dig) { return acc * 10 + dig; },
+            [limit_dig](std::uint32_t acc, int dig) { return acc < INT32_MAX_DIV_10 || dig <= limit_dig; });
+    };
+
+    constexpr auto neg_parser = Combine(
+        Map(ParseChar('-'), [](char _) { return -1; }), abs_parser(INT32_MAX_MOD_10 + 1),
+        [](int _, std::uint32_t val) { return static_cast<std::int32_t>(-1 * static_cast<std::int64_t>(val)); });
+
+    constexpr auto pos_parser =
+        Combine(Try(Map(ParseChar('+'), [](char _) { return 1; }), 1), abs_parser(INT32_MAX_MOD_10),
+                [](int _, std::uint32_t val) { return static_cast<std::int32_t>(val); });
+
+    return Or(neg_parser, pos_parser);
+}
+
+template <std::size_t Capacity>
+constexpr auto ParseCString()
+{
+    constexpr auto convert_special_char = [](char c) {
+        switch (c)
+        {
+            case 'n': return '\n';
+            case 't': return '\t';
+            default: return c;
+        }
+    };
+    constexpr auto escape_parser =
+        Map(Right(ParseChar('\\'), ParseOneOfChars(CharSet("abfnrtv'\\\""sv))), convert_special_char);
+
+    return Many(Or(escape_parser, ParseOneOfChars(~CharSet("\\\""sv))), StaticString<char, Capacity>(),
+                [](auto& acc, char ch) { acc.push_back(ch); });
+}
+
+template <std::size_t ElemCapacity, std::size_t Capacity, typename... Args>
+constexpr auto Format(ParserInput code, Args... args)
+{
+    const auto packed_args    = fmt::__impl::MakeFormatArgs(args...);
+    const auto str_parser     = Many(ParseOneOfChars(~CharSet("{}"sv)), StaticString<char, ElemCapacity>(),
+                                     [](auto& acc, char ch) { acc.push_back(ch); });
+    const auto uint_parser    = DoWhile(digit_parser, static_cast<std::uint64_t>(0),
+                                        [](std::uint64_t acc, int dig) { return acc * 10 + dig; },
+                                        [](std::uint64_t acc, int dig) { return acc < (1ull << 60); });
+    const auto indexer_parser = Left(Right(ParseChar('{'), uint_parser), ParseChar('}'));
+    const auto elem_parser    = Combine(str_parser, indexer_parser, [=](auto str, std::uint64_t n) {
+        fmt::__impl::AppendNthArg(str, n, packed_args);
+        return str;
+    });
+    return Many(elem_parser, StaticString<char, Capacity>(), [](auto& acc, const auto& str) {
+        d1::copy(str.begin(), str.end(), d1::back_insert_iterator(acc));
+    })(code);
+}
+}  // namespace monadic
+
+namespace
+{
+constexpr std::size_t FORMAT_CAPACITY = 1 << 16;
+
+template <typename Parser>
+void RunIntegers(benchmark::State& state, const Parser& parser)
+{
+    const auto corpus = bench::corpus::Integers(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = parser(code);
+            sum += result.unwrap().first;
+            code = result.unwrap().second.substr(1);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+template <typename Parser>
+void RunCString(benchmark::State& state, const Parser& parser)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parser(corpus));
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+template <typename Format>
+void RunFormat(benchmark::State& state, const Format& format)
+{
+    const auto corpus = bench::corpus::FormatStrings(state.range(0), 4);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(format(corpus, "a"sv, "bb"sv, "ccc"sv, "dddd"sv));
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+}  // namespace
+
+static void BM_Engine_Int32_Monadic(benchmark::State& state)
+{
+    RunIntegers(state, monadic::ParseInt32());
+}
+BENCHMARK(BM_Engine_Int32_Monadic)->Range(1 << 10, 1 << 16);
+
+static void BM_Engine_Int32_Lowered(benchmark::State& state)
+{
+    RunIntegers(state, int32_parser);
+}
+BENCHMARK(BM_Engine_Int32_Lowered)->Range(1 << 10, 1 << 16);
+
+static void BM_Engine_CString_Monadic(benchmark::State& state)
+{
+    RunCString(state, monadic::ParseCString<1 << 16>());
+}
+BENCHMARK(BM_Engine_CString_Monadic)->Range(1 << 10, 1 << 16);
+
+static void BM_Engine_CString_Lowered(benchmark::State& state)
+{
+    RunCString(state, c_str_parser<1 << 16>);
+}
+BENCHMARK(BM_Engine_CString_Lowered)->Range(1 << 10, 1 << 16);
+
+static void BM_Engine_Format_Monadic(benchmark::State& state)
+{
+    RunFormat(state, [](ParserInput code, auto... args) {
+        return monadic::Format<256, FORMAT_CAPACITY>(code, args...);
+    });
+}
+BENCHMARK(BM_Engine_Format_Monadic)->Range(1 << 8, 1 << 14);
+
+static void BM_Engine_Format_Lowered(benchmark::State& state)
+{
+    RunFormat(state, fmt::format_parser<256, FORMAT_CAPACITY, std::string_view, std::string_view, std::string_view,
+                                        std::string_view>);
+}
+BENCHMARK(BM_Engine_Format_Lowered)->Range(1 << 8, 1 << 14);
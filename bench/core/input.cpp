@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+// A file of `bytes` bytes of integers in the temporary directory, written once per size.
+std::filesystem::path IntegerFile(std::size_t bytes)
+{
+    const auto path = std::filesystem::temp_directory_path() / ("parser_demo_bench_" + std::to_string(bytes));
+    if (!std::filesystem::exists(path) || std::filesystem::file_size(path) < bytes)
+    {
+        const auto corpus = bench::corpus::Integers(bytes, 32, false);
+        std::ofstream(path, std::ios::binary).write(corpus.data(), static_cast<std::streamsize>(corpus.size()));
+    }
+    return path;
+}
+
+std::uint64_t SumIntegers(ParserInput code)
+{
+    std::uint64_t sum = 0;
+    while (!code.empty())
+    {
+        const auto result = uint32_parser(code);
+        if (result.is_none())
+        {
+            code.remove_prefix(1);
+            continue;
+        }
+        sum += result.unwrap().first;
+        code = result.unwrap().second;
+    }
+    return sum;
+}
+}  // namespace
+
+// Read the whole file into a buffer first: one more copy, and the whole file resident at once.
+static void BM_File_ReadIntoBuffer(benchmark::State& state)
+{
+    const auto path = IntegerFile(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::string   buffer(std::filesystem::file_size(path), '\0');
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        benchmark::DoNotOptimize(SumIntegers(buffer));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_File_ReadIntoBuffer)->RangeMultiplier(16)->Range(1 << 16, 1 << 24)->Unit(benchmark::kMillisecond);
+
+// Parse the mapping in place.
+static void BM_File_Mapped(benchmark::State& state)
+{
+    const auto path = IntegerFile(state.range(0));
+
+    for (auto _ : state)
+    {
+        const auto input = MappedInput(path);
+
+        benchmark::DoNotOptimize(SumIntegers(input));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_File_Mapped)->RangeMultiplier(16)->Range(1 << 16, 1 << 24)->Unit(benchmark::kMillisecond);
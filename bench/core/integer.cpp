@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+template <typename Parser>
+void RunIntegers(benchmark::State& state, const Parser& int_parser)
+{
+    const auto corpus = bench::corpus::Integers(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::uint64_t total = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = int_parser(code);
+            if (result.is_some())
+            {
+                total += static_cast<std::uint64_t>(result.unwrap().first);
+                code = result.unwrap().second;
+            }
+            code.remove_prefix(code.empty() ? 0 : 1);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+// One digit per step: the digit parser, the fold and the overflow predicate run for every digit.
+constexpr auto FoldUint64()
+{
+    constexpr std::uint64_t DIV = std::numeric_limits<std::uint64_t>::max() / 10;
+    constexpr std::uint64_t MOD = std::numeric_limits<std::uint64_t>::max() % 10;
+
+    return DoWhile(
+        digit_parser, std::uint64_t{0}, [](std::uint64_t acc, int dig) { return acc * 10 + dig; },
+        [](std::uint64_t acc, std::uint64_t dig) { return acc < DIV || (acc == DIV && dig <= MOD); });
+}
+}  // namespace
+
+static void BM_Uint64_DigitFold(benchmark::State& state)
+{
+    RunIntegers(state, Try(ParseOneOfChars("+-"sv), '+') >> FoldUint64());
+}
+BENCHMARK(BM_Uint64_DigitFold)->Range(1 << 10, 1 << 20);
+
+// 8 digits per step.
+static void BM_Uint64_Swar(benchmark::State& state)
+{
+    RunIntegers(state, Try(ParseOneOfChars("+-"sv), '+') >> uint64_parser);
+}
+BENCHMARK(BM_Uint64_Swar)->Range(1 << 10, 1 << 20);
+
+static void BM_Int32_Swar(benchmark::State& state)
+{
+    RunIntegers(state, int32_parser);
+}
+BENCHMARK(BM_Int32_Swar)->Range(1 << 10, 1 << 20);
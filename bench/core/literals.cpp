@@ -0,0 +1,233 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+
+#include "../../inc/parser_demo"
+#include "../../src/fmt/inc/parser.hpp"
+#include "../corpus.hpp"
+#include "../runner.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+using bench::runner::RunTokens;
+
+// The basic parsers and literals, each over a corpus of the tokens it accepts, separated by single spaces.
+// Reports bytes/s and tokens (items)/s.
+
+static void BM_ParseChar(benchmark::State& state)
+{
+    constexpr std::string_view words[] = {"a"};
+
+    RunTokens(state, bench::corpus::Words(state.range(0), words), ParseChar('a'));
+}
+BENCHMARK(BM_ParseChar)->Range(1 << 10, 1 << 20);
+
+static void BM_ParseString(benchmark::State& state)
+{
+    constexpr std::string_view words[] = {"message"};
+
+    RunTokens(state, bench::corpus::Words(state.range(0), words), ParseString("message"sv));
+}
+BENCHMARK(BM_ParseString)->Range(1 << 10, 1 << 20);
+
+static void BM_ParseStringLiteral(benchmark::State& state)
+{
+    constexpr std::string_view words[] = {"message"};
+
+    RunTokens(state, bench::corpus::Words(state.range(0), words), ParseString<"message">());
+}
+BENCHMARK(BM_ParseStringLiteral)->Range(1 << 10, 1 << 20);
+
+namespace
+{
+constexpr std::string_view header_names[] = {"Host:",          "Accept:",        "Content-Type:", "Content-Length:",
+                                             "Accept-Encoding:", "User-Agent:", "Connection:",   "Cookie:"};
+}  // namespace
+
+// HTTP header names, by runtime strings and by literals
+static void BM_HeaderNames(benchmark::State& state)
+{
+    const auto parser = Choice(ParseString("Host:"sv), ParseString("Accept:"sv), ParseString("Content-Type:"sv),
+                               ParseString("Content-Length:"sv), ParseString("Accept-Encoding:"sv),
+                               ParseString("User-Agent:"sv), ParseString("Connection:"sv), ParseString("Cookie:"sv));
+
+    RunTokens(state, bench::corpus::Words(state.range(0), header_names), parser);
+}
+BENCHMARK(BM_HeaderNames)->Range(1 << 10, 1 << 20);
+
+static void BM_HeaderNamesLiteral(benchmark::State& state)
+{
+    const auto parser = Choice(ParseString<"Host:">(), ParseString<"Accept:">(), ParseString<"Content-Type:">(),
+                               ParseString<"Content-Length:">(), ParseString<"Accept-Encoding:">(),
+                               ParseString<"User-Agent:">(), ParseString<"Connection:">(), ParseString<"Cookie:">());
+
+    RunTokens(state, bench::corpus::Words(state.range(0), header_names), parser);
+}
+BENCHMARK(BM_HeaderNamesLiteral)->Range(1 << 10, 1 << 20);
+
+// the same, as a single trie
+static void BM_HeaderNamesTrie(benchmark::State& state)
+{
+    const auto parser = ParseOneOfStrings<"Host:", "Accept:", "Content-Type:", "Content-Length:", "Accept-Encoding:",
+                                          "User-Agent:", "Connection:", "Cookie:">();
+
+    RunTokens(state, bench::corpus::Words(state.range(0), header_names), parser);
+}
+BENCHMARK(BM_HeaderNamesTrie)->Range(1 << 10, 1 << 20);
+
+namespace
+{
+// the keywords of C89, which share many prefixes
+constexpr std::string_view c_keywords[] = {
+    "auto",   "break",  "case",    "char",   "const",    "continue", "default",  "do",
+    "double", "else",   "enum",    "extern", "float",    "for",      "goto",     "if",
+    "int",    "long",   "register", "return", "short",   "signed",   "sizeof",   "static",
+    "struct", "switch", "typedef", "union",  "unsigned", "void",     "volatile", "while"};
+}  // namespace
+
+// C keywords, by a `Choice` of literals (the longer of two keywords sharing a prefix first) and by a trie
+static void BM_CKeywords(benchmark::State& state)
+{
+    const auto parser = Choice(
+        ParseString<"auto">(), ParseString<"break">(), ParseString<"case">(), ParseString<"char">(),
+        ParseString<"const">(), ParseString<"continue">(), ParseString<"default">(), ParseString<"double">(),
+        ParseString<"do">(), ParseString<"else">(), ParseString<"enum">(), ParseString<"extern">(),
+        ParseString<"float">(), ParseString<"for">(), ParseString<"goto">(), ParseString<"if">(),
+        ParseString<"int">(), ParseString<"long">(), ParseString<"register">(), ParseString<"return">(),
+        ParseString<"short">(), ParseString<"signed">(), ParseString<"sizeof">(), ParseString<"static">(),
+        ParseString<"struct">(), ParseString<"switch">(), ParseString<"typedef">(), ParseString<"union">(),
+        ParseString<"unsigned">(), ParseString<"void">(), ParseString<"volatile">(), ParseString<"while">());
+
+    RunTokens(state, bench::corpus::Words(state.range(0), c_keywords), parser);
+}
+BENCHMARK(BM_CKeywords)->Range(1 << 10, 1 << 20);
+
+static void BM_CKeywordsTrie(benchmark::State& state)
+{
+    const auto parser =
+        ParseOneOfStrings<"auto", "break", "case", "char", "const", "continue", "default", "do", "double", "else",
+                          "enum", "extern", "float", "for", "goto", "if", "int", "long", "register", "return",
+                          "short", "signed", "sizeof", "static", "struct", "switch", "typedef", "union", "unsigned",
+                          "void", "volatile", "while">();
+
+    RunTokens(state, bench::corpus::Words(state.range(0), c_keywords), parser);
+}
+BENCHMARK(BM_CKeywordsTrie)->Range(1 << 10, 1 << 20);
+
+static void BM_ParseOneOfChars(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::Identifiers(state.range(0)), ParseOneOfChars(alphabet_set));
+}
+BENCHMARK(BM_ParseOneOfChars)->Range(1 << 10, 1 << 20);
+
+static void BM_CStringParser(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::CStrings(state.range(0)), c_str_parser<64>);
+}
+BENCHMARK(BM_CStringParser)->Range(1 << 10, 1 << 20);
+
+// the same, with the capacity sized for the longest string which may ever come
+static void BM_CStringParser4K(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::CStrings(state.range(0)), c_str_parser<4096>);
+}
+BENCHMARK(BM_CStringParser4K)->Range(1 << 10, 1 << 20);
+
+// the same, into an `ArenaString` which has no capacity, in one arena scope per pass over the corpus
+static void BM_CStringArena(benchmark::State& state)
+{
+    const auto corpus = bench::corpus::CStrings(state.range(0));
+    const auto parser = ParseArenaCString();
+
+    Arena arena;
+    for (auto _ : state)
+    {
+        ArenaScope scope(arena);
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = parser(code);
+            if (result.is_some() && result.unwrap().second.size() < code.size())
+            {
+                benchmark::DoNotOptimize(result.unwrap().first.data());
+                code = result.unwrap().second;
+            }
+            else
+            {
+                code.remove_prefix(1);
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_CStringArena)->Range(1 << 10, 1 << 20);
+
+// the same, only matched: no string is built
+static void BM_CStringRecognize(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::CStrings(state.range(0)), Recognize(c_str_parser<64>));
+}
+BENCHMARK(BM_CStringRecognize)->Range(1 << 10, 1 << 20);
+
+static void BM_Int32Parser(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::Integers(state.range(0), 31, true), int32_parser);
+}
+BENCHMARK(BM_Int32Parser)->Range(1 << 10, 1 << 20);
+
+static void BM_Int64Parser(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::Integers(state.range(0), 63, true), int64_parser);
+}
+BENCHMARK(BM_Int64Parser)->Range(1 << 10, 1 << 20);
+
+static void BM_Uint32Parser(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::Integers(state.range(0), 32, false), uint32_parser);
+}
+BENCHMARK(BM_Uint32Parser)->Range(1 << 10, 1 << 20);
+
+static void BM_Uint64Parser(benchmark::State& state)
+{
+    RunTokens(state, bench::corpus::Integers(state.range(0), 64, false), uint64_parser);
+}
+BENCHMARK(BM_Uint64Parser)->Range(1 << 10, 1 << 20);
+
+// Count the chars of an identifier.
+static void BM_ManyFold(benchmark::State& state)
+{
+    const auto length_parser = Many(alphabet_parser, std::size_t{0}, [](std::size_t acc, char) { return acc + 1; });
+
+    RunTokens(state, bench::corpus::Identifiers(state.range(0)), length_parser);
+}
+BENCHMARK(BM_ManyFold)->Range(1 << 10, 1 << 20);
+
+// Sum the digits of a number, up to a limit.
+static void BM_DoWhileFold(benchmark::State& state)
+{
+    const auto digit_sum_parser = DoWhile(
+        digit_parser, 0, [](int acc, int dig) { return acc + dig; }, [](int acc, int) { return acc < 100; });
+
+    RunTokens(state, bench::corpus::Integers(state.range(0), 64, false), digit_sum_parser);
+}
+BENCHMARK(BM_DoWhileFold)->Range(1 << 10, 1 << 20);
+
+// A whole format string per call, the items are the substituted arguments.
+static void BM_FormatParser(benchmark::State& state)
+{
+    constexpr std::size_t CAPACITY = 1 << 16;
+
+    const auto corpus = bench::corpus::FormatStrings(state.range(0), 4);
+    const auto format = fmt::format_parser<256, CAPACITY, std::string_view, std::string_view, std::string_view,
+                                           std::string_view>;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(format(corpus, "a"sv, "bb"sv, "ccc"sv, "dddd"sv));
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+    state.SetItemsProcessed(state.iterations() * std::count(corpus.begin(), corpus.end(), '{'));
+}
+BENCHMARK(BM_FormatParser)->Range(1 << 8, 1 << 14);
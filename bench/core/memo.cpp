@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+constexpr std::size_t DEPTH = 6;
+
+// level(n) := level(n-1) 'a' | level(n-1) 'b' | level(n-1), which re-parses level(n-1) up to 3 times per level.
+template <std::size_t Depth, typename Parser>
+auto Nested(const Parser& parser)
+{
+    if constexpr (Depth == 0)
+    {
+        return parser;
+    }
+    else
+    {
+        const auto inner = Nested<Depth - 1>(parser);
+        return (inner << ParseChar('a')) || (inner << ParseChar('b')) || inner;
+    }
+}
+
+template <std::size_t Depth, typename Parser>
+auto NestedMemo(MemoTable& table, const Parser& parser)
+{
+    if constexpr (Depth == 0)
+    {
+        return Memo(table, parser);
+    }
+    else
+    {
+        const auto inner = NestedMemo<Depth - 1>(table, parser);
+        return Memo(table, (inner << ParseChar('a')) || (inner << ParseChar('b')) || inner);
+    }
+}
+
+template <typename Parser>
+void RunWords(benchmark::State& state, const Parser& parser, MemoTable* table)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        if (table != nullptr)
+        {
+            table->clear();
+        }
+
+        std::size_t words = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = parser(code);
+            if (result.is_some())
+            {
+                words += 1;
+                code = result.unwrap().second;
+            }
+            code.remove_prefix(code.empty() ? 0 : 1);
+        }
+        benchmark::DoNotOptimize(words);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+    if (table != nullptr)
+    {
+        const auto& stats = table->stats();
+        const auto  runs  = static_cast<double>(state.iterations());
+
+        state.counters["evaluations"]      = static_cast<double>(stats.evaluations) / runs;
+        state.counters["rescanned"]        = static_cast<double>(stats.rescanned_bytes) / runs;
+        state.counters["rescanned_nomemo"] = static_cast<double>(stats.rescanned_bytes_without_memo()) / runs;
+    }
+}
+}  // namespace
+
+static void BM_Backtracking_Plain(benchmark::State& state)
+{
+    RunWords(state, Nested<DEPTH>(TakeWhile1(alphabet_set)), nullptr);
+}
+BENCHMARK(BM_Backtracking_Plain)->Range(1 << 10, 1 << 14);
+
+static void BM_Backtracking_CountOnly(benchmark::State& state)
+{
+    MemoTable table(false);
+    RunWords(state, NestedMemo<DEPTH>(table, TakeWhile1(alphabet_set)), &table);
+}
+BENCHMARK(BM_Backtracking_CountOnly)->Range(1 << 10, 1 << 14);
+
+static void BM_Backtracking_Memo(benchmark::State& state)
+{
+    MemoTable table;
+    RunWords(state, NestedMemo<DEPTH>(table, TakeWhile1(alphabet_set)), &table);
+}
+BENCHMARK(BM_Backtracking_Memo)->Range(1 << 10, 1 << 14);
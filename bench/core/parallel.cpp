@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "../../inc/parser_demo"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+// record := key '=' int
+const auto record_parser = Combine(TakeWhile1(alphabet_set) << ParseChar('='), int32_parser,
+                                   [](std::string_view key, int value) { return key.size() + value; });
+
+const std::string& Corpus()
+{
+    static const auto corpus = [] {
+        std::string out;
+        for (std::size_t i = 0; out.size() < (1 << 24); ++i)
+        {
+            out += std::string(1 + i % 13, 'k') + "=" + std::to_string(i * 7919 % 100000) + "\n";
+        }
+        return out;
+    }();
+    return corpus;
+}
+}  // namespace
+
+// One thread, record by record, the baseline.
+static void BM_Parallel_Serial(benchmark::State& state)
+{
+    const auto& corpus = Corpus();
+
+    for (auto _ : state)
+    {
+        std::vector<std::size_t> results;
+        for (ParserInput code = corpus; !code.empty();)
+        {
+            const auto line = code.substr(0, code.find('\n'));
+            results.push_back(record_parser(line).unwrap().first);
+            code.remove_prefix(std::min(line.size() + 1, code.size()));
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetBytesProcessed(state.iterations() * Corpus().size());
+}
+BENCHMARK(BM_Parallel_Serial)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// `range(0)` threads.
+static void BM_Parallel_Threads(benchmark::State& state)
+{
+    const auto& corpus  = Corpus();
+    const auto  options = ParallelOptions{.threads = static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ParallelParse(record_parser, corpus, '\n', options).unwrap().data());
+    }
+    state.SetBytesProcessed(state.iterations() * Corpus().size());
+}
+BENCHMARK(BM_Parallel_Threads)->RangeMultiplier(2)->Range(1, 32)->Unit(benchmark::kMillisecond)->UseRealTime();
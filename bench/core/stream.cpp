@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+// item := spaces int
+const auto item_parser = TakeWhile(" "sv) >> uint32_parser;
+
+const std::string& Corpus()
+{
+    static const auto corpus = bench::corpus::Integers(1 << 22, 32, false);
+    return corpus;
+}
+}  // namespace
+
+// The whole input at once, the baseline.
+static void BM_Stream_WholeInput(benchmark::State& state)
+{
+    const auto& corpus = Corpus();
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (ParserInput code = corpus; !code.empty();)
+        {
+            const auto result = item_parser(code);
+            if (result.is_none())
+            {
+                break;
+            }
+            sum += result.unwrap().first;
+            code = result.unwrap().second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * Corpus().size());
+}
+BENCHMARK(BM_Stream_WholeInput)->Unit(benchmark::kMillisecond);
+
+// The same input in chunks of `range(0)` bytes, as read from a pipe: the cost of the items split across chunks.
+static void BM_Stream_Chunks(benchmark::State& state)
+{
+    const auto& corpus = Corpus();
+    const auto  size   = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum    = 0;
+        auto          stream = StreamParser(item_parser, 4096);
+        const auto    sink   = [&sum](std::uint32_t value) { sum += value; };
+        for (std::size_t pos = 0; pos < corpus.size(); pos += size)
+        {
+            stream.feed(ParserInput(corpus).substr(pos, size), sink);
+        }
+        stream.finish(sink);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * Corpus().size());
+}
+BENCHMARK(BM_Stream_Chunks)->RangeMultiplier(16)->Range(64, 1 << 16)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace bench::corpus
+{
+using namespace std::literals;
+
+namespace __impl
+{
+    // xorshift, so the corpora are identical between runs and machines.
+    class Random
+    {
+    public:
+        constexpr explicit Random(std::uint64_t seed) : _state(seed) {}
+
+        constexpr std::uint64_t next() noexcept
+        {
+            _state ^= _state << 13;
+            _state ^= _state >> 7;
+            _state ^= _state << 17;
+            return _state;
+        }
+
+        constexpr std::size_t below(std::size_t n) noexcept
+        {
+            return static_cast<std::size_t>(next() % n);
+        }
+
+    private:
+        std::uint64_t _state;
+    };
+}  // namespace __impl
+
+// `bytes` bytes of `[a-zA-Z]+` identifiers separated by single spaces.
+inline std::string Identifiers(std::size_t bytes)
+{
+    constexpr auto alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"sv;
+
+    auto        random = __impl::Random(0x9E3779B97F4A7C15);
+    std::string out;
+    out.reserve(bytes);
+    while (out.size() < bytes)
+    {
+        const auto len = 1 + random.below(16);
+        for (std::size_t i = 0; i < len && out.size() < bytes; ++i)
+        {
+            out.push_back(alphabet[random.below(alphabet.size())]);
+        }
+        if (out.size() < bytes)
+        {
+            out.push_back(' ');
+        }
+    }
+    return out;
+}
+
+// `bytes` bytes of words picked from `words`, separated by single spaces.
+inline std::string Words(std::size_t bytes, std::span<const std::string_view> words)
+{
+    auto        random = __impl::Random(0xE7037ED1A0B428DB);
+    std::string out;
+    out.reserve(bytes + 16);
+    while (out.size() < bytes)
+    {
+        out += words[random.below(words.size())];
+        out.push_back(' ');
+    }
+    return out;
+}
+
+// `bytes` bytes of space separated decimal integers in [-2^31, 2^31), with an optional sign.
+inline std::string Integers(std::size_t bytes)
+{
+    auto        random = __impl::Random(0xD1B54A32D192ED03);
+    std::string out;
+    out.reserve(bytes + 16);
+    while (out.size() < bytes)
+    {
+        const auto sign  = random.below(3);
+        const auto value = static_cast<std::uint32_t>(random.next()) >> random.below(32);
+        out += sign == 0 ? "-" : sign == 1 ? "+" : "";
+        out += std::to_string(value >> 1);
+        out.push_back(' ');
+    }
+    return out;
+}
+
+// `bytes` bytes of space separated decimal integers in [0, 2^bits) with a log-uniform magnitude, and with an optional
+// sign if `sign`.
+inline std::string Integers(std::size_t bytes, unsigned bits, bool sign)
+{
+    auto        random = __impl::Random(0x2545F4914F6CDD1D + bits);
+    std::string out;
+    out.reserve(bytes + 24);
+    while (out.size() < bytes)
+    {
+        const auto shift = 64 - bits + random.below(bits);
+        if (sign)
+        {
+            out += random.below(2) == 0 ? "-" : "+";
+        }
+        out += std::to_string(random.next() >> shift);
+        out.push_back(' ');
+    }
+    return out;
+}
+
+// `bytes` bytes of C string bodies (`[a-zA-Z ]` and escape sequences), each closed by a '"'.
+inline std::string CStrings(std::size_t bytes)
+{
+    constexpr auto plain   = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ "sv;
+    constexpr auto escaped = "abfnrtv'\\\""sv;
+
+    auto        random = __impl::Random(0xF1357AEA2E62A9C5);
+    std::string out;
+    out.reserve(bytes + 64);
+    while (out.size() < bytes)
+    {
+        const auto len = 8 + random.below(56);
+        for (std::size_t i = 0; i < len; ++i)
+        {
+            if (random.below(16) == 0)
+            {
+                out.push_back('\\');
+                out.push_back(escaped[random.below(escaped.size())]);
+            }
+            else
+            {
+                out.push_back(plain[random.below(plain.size())]);
+            }
+        }
+        out.push_back('"');
+    }
+    return out;
+}
+
+// `bytes` bytes of space separated sums of integers like `1+(23+(4+5))+6`, nested up to `depth` parentheses.
+inline std::string Expressions(std::size_t bytes, std::size_t depth)
+{
+    auto random = __impl::Random(0x8EBC6AF09C88C6E3);
+    auto sum    = [&random, depth](auto& self, std::string& out, std::size_t level) -> void {
+        const auto terms = 1 + random.below(3);
+        for (std::size_t i = 0; i < terms; ++i)
+        {
+            if (i != 0)
+            {
+                out.push_back('+');
+            }
+            if (level < depth && random.below(2) == 0)
+            {
+                out.push_back('(');
+                self(self, out, level + 1);
+                out.push_back(')');
+            }
+            else
+            {
+                out += std::to_string(random.below(1000));
+            }
+        }
+    };
+
+    std::string out;
+    out.reserve(bytes + 256);
+    while (out.size() < bytes)
+    {
+        sum(sum, out, 0);
+        out.push_back(' ');
+    }
+    return out;
+}
+
+// `bytes` bytes of format strings like `id={0}, name={1}; `, referencing arguments [0, args).
+inline std::string FormatStrings(std::size_t bytes, std::size_t args)
+{
+    constexpr std::string_view words[] = {"id=", "name=", ", value=", "; ", " status:", " at "};
+
+    auto        random = __impl::Random(0xA0761D6478BD642F);
+    std::string out;
+    out.reserve(bytes + 16);
+    while (out.size() < bytes)
+    {
+        out += words[random.below(std::size(words))];
+        out += '{';
+        out += std::to_string(random.below(args));
+        out += '}';
+    }
+    return out;
+}
+
+}  // namespace bench::corpus
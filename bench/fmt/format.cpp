@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../../src/fmt/inc/compile.hpp"
+#include "../../src/fmt/inc/parser.hpp"
+#include "../../src/fmt/inc/sink.hpp"
+#include "../corpus.hpp"
+
+using namespace std::literals;
+
+// One log line from a fixed template, formatted over and over: the format string parsed on every call
+// (`format_parser`) against parsed once at compile time (`compile`).
+// Reports lines (items)/s.
+
+constexpr auto LOG_LINE = "id={0}, name={1}, value={2}; status: {3} at {0}"sv;
+
+static void BM_FormatLine_Parser(benchmark::State& state)
+{
+    const auto format = fmt::format_parser<64, 256, std::string_view, std::string_view, std::string_view,
+                                           std::string_view>;
+    auto       line   = LOG_LINE;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(line);
+        benchmark::DoNotOptimize(format(line, "42"sv, "parser"sv, "3.14"sv, "ok"sv));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatLine_Parser);
+
+static void BM_FormatLine_Compiled(benchmark::State& state)
+{
+    constexpr auto format = fmt::compile<"id={0}, name={1}, value={2}; status: {3} at {0}">();
+    auto           arg    = "42"sv;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(arg);
+        benchmark::DoNotOptimize(format.format<256>(arg, "parser"sv, "3.14"sv, "ok"sv));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatLine_Compiled);
+
+// A log line of numbers: rendered in place by `compile`, against `snprintf`.
+
+static void BM_FormatNumbers_Compiled(benchmark::State& state)
+{
+    constexpr auto format = fmt::compile<"id={0}, count={1}, mean={2}, ratio={3}">();
+    auto           id     = std::int64_t{-1234567};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(id);
+        benchmark::DoNotOptimize(format.format<256>(id, 42u, 3.14159, 0.001));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatNumbers_Compiled);
+
+static void BM_FormatNumbers_Snprintf(benchmark::State& state)
+{
+    auto id = std::int64_t{-1234567};
+    char out[256];
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(id);
+        benchmark::DoNotOptimize(
+            std::snprintf(out, sizeof(out), "id=%lld, count=%u, mean=%g, ratio=%g", static_cast<long long>(id), 42u,
+                          3.14159, 0.001));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatNumbers_Snprintf);
+
+// The numbers above padded, in hex and at a fixed precision: the specs are parsed at compile time, against `printf`
+// which interprets them per call.
+static void BM_FormatSpec_Compiled(benchmark::State& state)
+{
+    constexpr auto format = fmt::compile<"id={0:>10}, count={1:#06x}, mean={2:8.3f}, ratio={3:.2e}">();
+    auto           id     = std::int64_t{-1234567};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(id);
+        benchmark::DoNotOptimize(format.format<256>(id, 42u, 3.14159, 0.001));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatSpec_Compiled);
+
+static void BM_FormatSpec_Snprintf(benchmark::State& state)
+{
+    auto id = std::int64_t{-1234567};
+    char out[256];
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(id);
+        benchmark::DoNotOptimize(std::snprintf(out, sizeof(out), "id=%10lld, count=%#06x, mean=%8.3f, ratio=%.2e",
+                                               static_cast<long long>(id), 42u, 3.14159, 0.001));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatSpec_Snprintf);
+
+// Wide templates, as in structured logs: a format string of `state.range(0)` placeholders over as many arguments,
+// each placeholder picking one at random. The argument of a placeholder is found at runtime (`format_parser`), so this
+// measures the dispatch on its index.
+
+namespace
+{
+constexpr std::string_view FIELDS[] = {"alpha"sv, "beta"sv, "gamma"sv, "delta"sv, "epsilon"sv, "zeta"sv,
+                                       "eta"sv,   "theta"sv, "iota"sv,  "kappa"sv, "lambda"sv,  "mu"sv};
+
+template <std::size_t Arity>
+void RunWideFormat(benchmark::State& state)
+{
+    const auto corpus = bench::corpus::FormatStrings(1 << 12, Arity);
+    [&]<std::size_t... Idx>(std::index_sequence<Idx...>) {
+        const auto format = fmt::format_parser<256, 1 << 16, decltype((void)Idx, std::string_view{})...>;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(format(corpus, std::string_view(FIELDS[Idx % std::size(FIELDS)])...));
+        }
+    }(std::make_index_sequence<Arity>{});
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+    state.SetItemsProcessed(state.iterations() * std::count(corpus.begin(), corpus.end(), '{'));
+}
+}  // namespace
+
+static void BM_FormatWide_8(benchmark::State& state)
+{
+    RunWideFormat<8>(state);
+}
+BENCHMARK(BM_FormatWide_8);
+
+static void BM_FormatWide_16(benchmark::State& state)
+{
+    RunWideFormat<16>(state);
+}
+BENCHMARK(BM_FormatWide_16);
+
+static void BM_FormatWide_32(benchmark::State& state)
+{
+    RunWideFormat<32>(state);
+}
+BENCHMARK(BM_FormatWide_32);
+
+// The 4-argument corpus of `BM_FormatParser` (bench/core/literals.cpp), its format string parsed at runtime, streamed
+// by `format_to` into a caller buffer: every byte copied once, against twice by `format_parser`.
+
+static void BM_FormatTo_Span(benchmark::State& state)
+{
+    const auto        corpus = bench::corpus::FormatStrings(state.range(0), 4);
+    std::vector<char> buffer(corpus.size() * 2);
+
+    for (auto _ : state)
+    {
+        auto sink = fmt::SpanSink(buffer);
+        fmt::format_to(sink, corpus, "a"sv, "bb"sv, "ccc"sv, "dddd"sv);
+        benchmark::DoNotOptimize(sink.size());
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+    state.SetItemsProcessed(state.iterations() * std::count(corpus.begin(), corpus.end(), '{'));
+}
+BENCHMARK(BM_FormatTo_Span)->Range(1 << 8, 1 << 14);
+
+// Log lines written to a file descriptor (/dev/null) through `FdWriter`: one syscall per buffer.
+
+static void BM_FormatLine_FdWriter(benchmark::State& state)
+{
+    const int fd     = ::open("/dev/null", O_WRONLY | O_CLOEXEC);
+    auto      writer = fmt::FdWriter<>(fd);
+    auto      arg    = "42"sv;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(arg);
+        fmt::format_to<"id={0}, name={1}, value={2}; status: {3} at {0}\n">(writer, arg, "parser"sv, "3.14"sv, "ok"sv);
+    }
+    writer.flush();
+    ::close(fd);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatLine_FdWriter);
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <string_view>
+
+namespace bench::runner
+{
+// Parse the corpus token by token with `parser`, skipping a byte wherever it fails (e.g. on separators).
+// Reports bytes/s over the corpus, and items/s over the parsed tokens.
+template <typename Parser>
+void RunTokens(benchmark::State& state, std::string_view corpus, const Parser& parser)
+{
+    std::size_t items = 0;
+    for (auto _ : state)
+    {
+        for (auto code = corpus; !code.empty();)
+        {
+            const auto result = parser(code);
+            if (result.is_some() && result.unwrap().second.size() < code.size())
+            {
+                benchmark::DoNotOptimize(result.unwrap().first);
+                items += 1;
+                code = result.unwrap().second;
+            }
+            else
+            {
+                code.remove_prefix(1);
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+    state.SetItemsProcessed(items);
+}
+}  // namespace bench::runner
@@ -0,0 +1,210 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+// Each `calgo` algorithm at runtime against the plain loop it falls back to under constant evaluation, over
+// `[a-zA-Z ]` text. Reports bytes/s.
+
+namespace
+{
+// The constexpr loops, kept as the baselines.
+namespace scalar
+{
+    const char* find(const char* first, const char* last, char value)
+    {
+        for (; first != last && *first != value; ++first)
+        {
+        }
+        return first;
+    }
+
+    const char* mismatch(const char* first1, const char* last1, const char* first2)
+    {
+        for (; first1 != last1 && *first1 == *first2; ++first1, ++first2)
+        {
+        }
+        return first1;
+    }
+
+    char* copy(const char* first, const char* last, char* dest)
+    {
+        for (; first != last; ++first, ++dest)
+        {
+            *dest = *first;
+        }
+        return dest;
+    }
+
+    void fill(char* first, char* last, char value)
+    {
+        for (; first != last; ++first)
+        {
+            *first = value;
+        }
+    }
+}  // namespace scalar
+
+template <typename Fn>
+void RunBytes(benchmark::State& state, Fn&& fn)
+{
+    for (auto _ : state)
+    {
+        fn();
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+// find a byte which is not in the text
+static void BM_Find_Loop(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(state.range(0));
+
+    RunBytes(state, [&] { benchmark::DoNotOptimize(scalar::find(text.data(), text.data() + text.size(), '!')); });
+}
+BENCHMARK(BM_Find_Loop)->Range(1 << 6, 1 << 20);
+
+static void BM_Find_Calgo(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(state.range(0));
+
+    RunBytes(state, [&] { benchmark::DoNotOptimize(calgo::find(text.begin(), text.end(), '!')); });
+}
+BENCHMARK(BM_Find_Calgo)->Range(1 << 6, 1 << 20);
+
+// compare two equal texts
+static void BM_Mismatch_Loop(benchmark::State& state)
+{
+    const auto text1 = bench::corpus::Identifiers(state.range(0));
+    const auto text2 = text1;
+
+    RunBytes(state, [&] {
+        benchmark::DoNotOptimize(scalar::mismatch(text1.data(), text1.data() + text1.size(), text2.data()));
+    });
+}
+BENCHMARK(BM_Mismatch_Loop)->Range(1 << 6, 1 << 20);
+
+static void BM_Mismatch_Calgo(benchmark::State& state)
+{
+    const auto text1 = bench::corpus::Identifiers(state.range(0));
+    const auto text2 = text1;
+
+    RunBytes(state, [&] {
+        benchmark::DoNotOptimize(calgo::mismatch(text1.begin(), text1.end(), text2.begin(), text2.end()));
+    });
+}
+BENCHMARK(BM_Mismatch_Calgo)->Range(1 << 6, 1 << 20);
+
+static void BM_Equal_Calgo(benchmark::State& state)
+{
+    const auto text1 = bench::corpus::Identifiers(state.range(0));
+    const auto text2 = text1;
+
+    RunBytes(state, [&] {
+        benchmark::DoNotOptimize(calgo::equal(text1.begin(), text1.end(), text2.begin(), text2.end()));
+    });
+}
+BENCHMARK(BM_Equal_Calgo)->Range(1 << 6, 1 << 20);
+
+static void BM_Copy_Loop(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(state.range(0));
+    auto       dest = std::string(text.size(), '\0');
+
+    RunBytes(state, [&] { scalar::copy(text.data(), text.data() + text.size(), dest.data()); });
+}
+BENCHMARK(BM_Copy_Loop)->Range(1 << 6, 1 << 20);
+
+static void BM_Copy_Calgo(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(state.range(0));
+    auto       dest = std::string(text.size(), '\0');
+
+    RunBytes(state, [&] { calgo::copy(text.begin(), text.end(), dest.begin()); });
+}
+BENCHMARK(BM_Copy_Calgo)->Range(1 << 6, 1 << 20);
+
+static void BM_Move_Calgo(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(state.range(0));
+    auto       dest = std::string(text.size(), '\0');
+
+    RunBytes(state, [&] { calgo::move(text.begin(), text.end(), dest.begin()); });
+}
+BENCHMARK(BM_Move_Calgo)->Range(1 << 6, 1 << 20);
+
+static void BM_Fill_Loop(benchmark::State& state)
+{
+    auto dest = std::string(state.range(0), '\0');
+
+    RunBytes(state, [&] { scalar::fill(dest.data(), dest.data() + dest.size(), 'x'); });
+}
+BENCHMARK(BM_Fill_Loop)->Range(1 << 6, 1 << 20);
+
+static void BM_Fill_Calgo(benchmark::State& state)
+{
+    auto dest = std::string(state.range(0), '\0');
+
+    RunBytes(state, [&] { calgo::fill(dest.begin(), dest.end(), 'x'); });
+}
+BENCHMARK(BM_Fill_Calgo)->Range(1 << 6, 1 << 20);
+
+// `StaticString` equality, which goes through `calgo::equal`
+static void BM_StaticStringEqual(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(1000);
+    const auto str1 = StaticString<char, 1024>(std::string_view(text));
+    const auto str2 = str1;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(str1 == str2);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_StaticStringEqual);
+
+// Append 1 KiB of text to a `StaticString` through a `back_insert_iterator`: a `push_back()` per char against
+// `calgo::copy`, which appends in bulk.
+static void BM_BackInsert_PushBack(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        StaticString<char, 1 << 16> str;
+        auto                        dest = back_insert_iterator(str);
+        for (const char ch : text)
+        {
+            *dest = ch;
+            ++dest;
+        }
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_BackInsert_PushBack)->Range(1 << 4, 1 << 16);
+
+static void BM_BackInsert_Calgo(benchmark::State& state)
+{
+    const auto text = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        StaticString<char, 1 << 16> str;
+        calgo::copy(text.begin(), text.end(), back_insert_iterator(str));
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_BackInsert_Calgo)->Range(1 << 4, 1 << 16);
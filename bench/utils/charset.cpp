@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+
+#include "../../inc/parser_demo"
+#include "../corpus.hpp"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+constexpr auto ALPHABET = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"sv;
+
+// a plain scan, as `calgo::find` was before it took `memchr` at runtime
+bool LinearContains(std::string_view chs, char ch)
+{
+    auto first = chs.cbegin();
+    for (; first != chs.cend() && *first != ch; ++first)
+    {
+    }
+    return first != chs.cend();
+}
+
+// The pre-`CharSet` implementation of `ParseOneOfChars`, kept as the baseline.
+constexpr auto ParseOneOfCharsLinear(std::string_view chs)
+{
+    return [chs](ParserInput code) -> ParserOutput<char> {
+        return (code.empty() || !LinearContains(chs, code[0])) ?
+                   NONE :
+                   SOME(std::make_pair(code[0], ParserInput(code.data() + 1, code.size() - 1)));
+    };
+}
+
+template <typename Parser>
+void RunCharParser(benchmark::State& state, const Parser& parser)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::size_t matched = 0;
+        for (auto code = ParserInput(corpus); !code.empty();)
+        {
+            const auto result = parser(code);
+            if (result.is_some())
+            {
+                matched += 1;
+                code = result.unwrap().second;
+            }
+            else
+            {
+                code.remove_prefix(1);
+            }
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+}  // namespace
+
+static void BM_Membership_LinearFind(benchmark::State& state)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::size_t hits = 0;
+        for (const char ch : corpus)
+        {
+            hits += LinearContains(ALPHABET, ch);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_Membership_LinearFind)->Range(1 << 10, 1 << 20);
+
+static void BM_Membership_CharSet(benchmark::State& state)
+{
+    const auto corpus = bench::corpus::Identifiers(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::size_t hits = 0;
+        for (const char ch : corpus)
+        {
+            hits += alphabet_set.contains(ch);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_Membership_CharSet)->Range(1 << 10, 1 << 20);
+
+static void BM_AlphabetParser_LinearFind(benchmark::State& state)
+{
+    RunCharParser(state, ParseOneOfCharsLinear(ALPHABET));
+}
+BENCHMARK(BM_AlphabetParser_LinearFind)->Range(1 << 10, 1 << 20);
+
+static void BM_AlphabetParser_CharSet(benchmark::State& state)
+{
+    RunCharParser(state, alphabet_parser);
+}
+BENCHMARK(BM_AlphabetParser_CharSet)->Range(1 << 10, 1 << 20);
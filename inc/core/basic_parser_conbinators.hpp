@@ -1,21 +1,35 @@
 #pragma once
 
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string_view>
+#include <type_traits>
 
 #include "../utils/algorithms.hpp"
+#include "../utils/arena.hpp"
+#include "../utils/charset.hpp"
 #include "../utils/containers.hpp"
+#include "../utils/decimal.hpp"
 #include "../utils/option.hpp"
 #include "./combinator.hpp"
 #include "./parser.hpp"
 
+using d1::core::combinator::Choice;
 using d1::core::combinator::Combine;
-using d1::core::combinator::DoWhile;
+using d1::core::combinator::Many;
 using d1::core::combinator::Try;
 using d1::core::parser::Map;
 using d1::core::parser::ParserInput;
 using d1::core::parser::ParserOutput;
+using d1::utils::arena::ArenaString;
+using d1::utils::charset::CharSet;
 using d1::utils::containers::StaticString;
+using d1::utils::decimal::DigitSpan;
+using d1::utils::decimal::ParseDigits;
+using d1::utils::decimal::ParseShortDigits;
 using d1::utils::option::NONE;
 using d1::utils::option::None;
 using d1::utils::option::SOME;
@@ -29,59 +43,641 @@ using namespace std::literals;
 
 constexpr auto MODULE_NAME{"core/basic_parser_combinator.hpp"sv};
 
+namespace __impl
+{
+    using d1::core::parser::__impl::FirstSet;
+    using d1::core::parser::__impl::HitEndOfInput;
+    using d1::core::parser::__impl::ParserBase;
+
+    class CharParser : public ParserBase<CharParser, char>
+    {
+    public:
+        constexpr explicit CharParser(char ch) : _ch(ch) {}
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            if (code.empty())
+            {
+                HitEndOfInput();
+                return false;
+            }
+            if (code[0] != _ch)
+            {
+                return false;
+            }
+            out = _ch;
+            code.remove_prefix(1);
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            CharSet chars;
+            chars.insert(_ch);
+            return {chars};
+        }
+
+    private:
+        char _ch;
+    };
+
+    class CharSetParser : public ParserBase<CharSetParser, char>
+    {
+    public:
+        constexpr explicit CharSetParser(const CharSet& set) : _set(set) {}
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            if (code.empty())
+            {
+                HitEndOfInput();
+                return false;
+            }
+            if (!_set.contains(code[0]))
+            {
+                return false;
+            }
+            out = code[0];
+            code.remove_prefix(1);
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return {_set};
+        }
+
+    private:
+        CharSet _set;
+    };
+
+    class StringParser : public ParserBase<StringParser, std::string_view>
+    {
+    public:
+        constexpr explicit StringParser(std::string_view str) : _str(str) {}
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            // a `memcmp` at runtime
+            if (!code.starts_with(_str))
+            {
+                // the input is a proper prefix of the string
+                if (code.size() < _str.size() && _str.starts_with(code))
+                {
+                    HitEndOfInput();
+                }
+                return false;
+            }
+            out = _str;
+            code.remove_prefix(_str.size());
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            if (_str.empty())
+            {
+                return {CharSet(), true};
+            }
+            CharSet chars;
+            chars.insert(_str[0]);
+            return {chars};
+        }
+
+    private:
+        std::string_view _str;
+    };
+
+    // A string literal as a template argument, for `ParseString<"GET">()`.
+    template <std::size_t N>
+    struct Literal
+    {
+        constexpr Literal(const char (&str)[N])
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                chars[i] = str[i];
+            }
+        }
+
+        constexpr std::string_view view() const noexcept
+        {
+            return {chars, N - 1};
+        }
+
+        char chars[N];
+    };
+
+    // `StringParser` with the string known at compile time, so the comparison is unrolled into word compares of
+    // constants: a single masked compare up to 8 bytes, overlapping 8-byte words up to 32 bytes, `memcmp` beyond.
+    template <Literal Str>
+    class LiteralParser : public ParserBase<LiteralParser<Str>, std::string_view>
+    {
+        static constexpr std::string_view STR = Str.view();
+        static constexpr std::size_t      LEN = STR.size();
+
+        // SWAR: 8 chars per `std::uint64_t`, the first char in the lowest byte
+        static constexpr bool SWAR = std::endian::native == std::endian::little;
+
+        // the 8 chars (or less, zero-padded) of `STR` at `pos`
+        static constexpr std::uint64_t Word(std::size_t pos) noexcept
+        {
+            std::uint64_t word = 0;
+            for (std::size_t i = 0; i < 8 && pos + i < LEN; ++i)
+            {
+                word |= std::uint64_t{static_cast<unsigned char>(STR[pos + i])} << (8 * i);
+            }
+            return word;
+        }
+
+        template <std::size_t Pos>
+        static constexpr std::uint64_t WORD = Word(Pos);
+
+        static std::uint64_t Load(const char* data) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data, 8);
+            return word;
+        }
+
+        // Whether `STR` is at `data`, which holds at least `LEN` chars, or 8 if `wide`.
+        static bool Equal(const char* data, bool wide) noexcept
+        {
+            if constexpr (LEN == 0)
+            {
+                return true;
+            }
+            else if constexpr (LEN < 8)
+            {
+                if (wide)
+                {
+                    constexpr auto mask = (std::uint64_t{1} << (8 * LEN)) - 1;
+                    return ((Load(data) ^ WORD<0>) & mask) == 0;
+                }
+                std::uint64_t word = 0;
+                std::memcpy(&word, data, LEN);
+                return word == WORD<0>;
+            }
+            else if constexpr (LEN <= 32)
+            {
+                // the words at 0, 8, ..., and the last one, which may overlap the one before
+                return [data]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    return ((Load(data + 8 * Is) == WORD<8 * Is>) && ...) && Load(data + LEN - 8) == WORD<LEN - 8>;
+                }(std::make_index_sequence<(LEN - 1) / 8>{});
+            }
+            else
+            {
+                return std::memcmp(data, STR.data(), LEN) == 0;
+            }
+        }
+
+    public:
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            bool matched;
+            if constexpr (SWAR)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    matched = code.size() >= LEN && Equal(code.data(), code.size() >= 8);
+                }
+                else
+                {
+                    matched = code.starts_with(STR);
+                }
+            }
+            else
+            {
+                matched = code.starts_with(STR);
+            }
+
+            if (!matched)
+            {
+                // the input is a proper prefix of the string
+                if (code.size() < LEN && STR.starts_with(code))
+                {
+                    HitEndOfInput();
+                }
+                return false;
+            }
+            out = STR;
+            code.remove_prefix(LEN);
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            if constexpr (LEN == 0)
+            {
+                return {CharSet(), true};
+            }
+            else
+            {
+                CharSet chars;
+                chars.insert(STR[0]);
+                return {chars};
+            }
+        }
+    };
+
+    // The trie of a set of strings, as a DFA over byte classes: the bytes which no string contains share class 0,
+    // which leads nowhere, so a transition is two table lookups, and the table holds `NODES * CLASSES` entries.
+    // Runs of nodes with a single child and no match (e.g. the "ntent-" of "Content-Type" and "Content-Length") are
+    // compressed into a chain, which is compared in one go instead of byte by byte.
+    template <Literal... Strs>
+    struct KeywordTrie
+    {
+        static constexpr std::string_view STRS[] = {Strs.view()...};
+        static constexpr std::size_t      COUNT  = sizeof...(Strs);
+
+        // no string ends at the node
+        static constexpr std::uint16_t NO_MATCH = COUNT;
+
+        static constexpr CharSet CHARS = [] {
+            CharSet chars;
+            for (const auto str : STRS)
+            {
+                chars = chars | CharSet(str);
+            }
+            return chars;
+        }();
+
+        static constexpr std::size_t CLASSES = CHARS.size() + 1;
+
+        // the root, and one node per distinct non-empty prefix
+        static constexpr std::size_t NODES = [] {
+            std::size_t nodes = 1;
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                for (std::size_t len = 1; len <= STRS[i].size(); ++len)
+                {
+                    bool seen = false;
+                    for (std::size_t j = 0; j < i && !seen; ++j)
+                    {
+                        seen = STRS[j].starts_with(STRS[i].substr(0, len));
+                    }
+                    nodes += !seen;
+                }
+            }
+            return nodes;
+        }();
+
+        static_assert(COUNT < 0xFFFF && NODES <= 0xFFFF, "too many strings");
+
+        using Node = std::conditional_t<NODES <= 0xFF, std::uint8_t, std::uint16_t>;
+
+        constexpr KeywordTrie()
+        {
+            std::uint16_t cls = 0;
+            for (std::size_t byte = 0; byte < 256; ++byte)
+            {
+                classes[byte] = CHARS.contains(static_cast<char>(byte)) ? ++cls : 0;
+            }
+
+            for (auto& index : match)
+            {
+                index = NO_MATCH;
+            }
+
+            std::size_t   children[NODES]{};
+            Node          child[NODES]{};
+            std::uint16_t depth[NODES]{};
+            std::uint16_t via[NODES]{};
+
+            // the root is nobody's child, so 0 also means "no transition"
+            std::size_t nodes = 1;
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                std::size_t node = 0;
+                for (const char ch : STRS[i])
+                {
+                    inner[node] = true;
+                    auto& to    = next[node * CLASSES + classes[static_cast<unsigned char>(ch)]];
+                    if (to == 0)
+                    {
+                        to = static_cast<Node>(nodes++);
+                        ++children[node];
+                        child[node] = to;
+                        depth[to]   = depth[node] + 1;
+                        via[to]     = static_cast<std::uint16_t>(i);
+                    }
+                    node = to;
+                }
+                // the first of duplicated strings wins
+                if (match[node] == NO_MATCH)
+                {
+                    match[node] = static_cast<std::uint16_t>(i);
+                }
+            }
+
+            for (std::size_t node = 0; node < NODES; ++node)
+            {
+                if (children[node] != 1)
+                {
+                    continue;
+                }
+                std::size_t end = child[node];
+                std::size_t len = 1;
+                for (; match[end] == NO_MATCH && children[end] == 1; ++len)
+                {
+                    end = child[end];
+                }
+                // a single byte is as cheap through the table
+                if (len > 1)
+                {
+                    const auto chars = STRS[via[end]].substr(depth[node], len);
+                    std::uint64_t word = 0;
+                    for (std::size_t i = 0; i < 8 && i < len; ++i)
+                    {
+                        word |= std::uint64_t{static_cast<unsigned char>(chars[i])} << (8 * i);
+                    }
+                    chains[node] = {chars, static_cast<Node>(end), word};
+                }
+            }
+        }
+
+        // the bytes from a node on to `end`, where the chain stops on a match or a branch
+        struct Chain
+        {
+            std::string_view chars{};
+            Node             end{};
+            // SWAR: up to the first 8 chars, the first one in the lowest byte
+            std::uint64_t word{};
+        };
+
+        std::uint16_t classes[256]{};
+        Node          next[NODES * CLASSES]{};
+        std::uint16_t match[NODES]{};
+        bool          inner[NODES]{};
+        Chain         chains[NODES]{};
+    };
+
+    // The longest of `Strs` the input starts with, in a single pass over the input through `KeywordTrie`.
+    // The result is the matched string, or its index in `Strs` if `Index`.
+    template <bool Index, Literal... Strs>
+    class KeywordsParser : public ParserBase<KeywordsParser<Index, Strs...>,
+                                             std::conditional_t<Index, std::size_t, std::string_view>>
+    {
+        using Trie = KeywordTrie<Strs...>;
+
+        static constexpr Trie TRIE{};
+
+        // a masked compare of a word when 8 bytes are left, a `memcmp` otherwise
+        static constexpr bool StartsWith(std::string_view code, const typename Trie::Chain& chain) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                if (!std::is_constant_evaluated() && chain.chars.size() <= 8 && code.size() >= 8)
+                {
+                    const auto    mask = ~std::uint64_t{0} >> (64 - 8 * chain.chars.size());
+                    std::uint64_t word;
+                    std::memcpy(&word, code.data(), 8);
+                    return ((word ^ chain.word) & mask) == 0;
+                }
+            }
+            return code.starts_with(chain.chars);
+        }
+
+    public:
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            std::size_t node    = 0;
+            std::size_t matched = TRIE.match[0];
+            std::size_t len     = 0;
+
+            for (std::size_t pos = 0;;)
+            {
+                if (pos == code.size())
+                {
+                    // the input is a proper prefix of a longer string
+                    if (TRIE.inner[node])
+                    {
+                        HitEndOfInput();
+                    }
+                    break;
+                }
+
+                if (const auto& chain = TRIE.chains[node]; !chain.chars.empty())
+                {
+                    const auto rest = code.substr(pos);
+                    if (!StartsWith(rest, chain))
+                    {
+                        if (rest.size() < chain.chars.size() && chain.chars.starts_with(rest))
+                        {
+                            HitEndOfInput();
+                        }
+                        break;
+                    }
+                    pos += chain.chars.size();
+                    node = chain.end;
+                }
+                else
+                {
+                    node = TRIE.next[node * Trie::CLASSES + TRIE.classes[static_cast<unsigned char>(code[pos])]];
+                    if (node == 0)
+                    {
+                        break;
+                    }
+                    pos += 1;
+                }
+
+                if (TRIE.match[node] != Trie::NO_MATCH)
+                {
+                    matched = TRIE.match[node];
+                    len     = pos;
+                }
+            }
+
+            if (matched == Trie::NO_MATCH)
+            {
+                return false;
+            }
+
+            if constexpr (Index)
+            {
+                out = matched;
+            }
+            else
+            {
+                out = Trie::STRS[matched];
+            }
+            code.remove_prefix(len);
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            CharSet chars;
+            for (const auto str : Trie::STRS)
+            {
+                if (!str.empty())
+                {
+                    chars.insert(str[0]);
+                }
+            }
+            return {chars, TRIE.match[0] != Trie::NO_MATCH};
+        }
+    };
+
+    // Digits as long as the value does not exceed `Max`: the parser stops before the digit which would overflow.
+    // The digits are counted and converted 8 at a time (`DigitSpan`, `ParseDigits`), and since `Max` has `DIGITS`
+    // digits, only the `DIGITS`-th significant digit needs an overflow check.
+    template <typename U, U Max>
+    class DecimalParser : public ParserBase<DecimalParser<U, Max>, U>
+    {
+        static constexpr std::size_t DIGITS = [] {
+            std::size_t digits = 1;
+            for (U value = Max; value >= 10; value /= 10)
+            {
+                ++digits;
+            }
+            return digits;
+        }();
+
+    public:
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            const auto first = code.data();
+            const auto last  = code.data() + code.size();
+
+            if (!std::is_constant_evaluated() && DIGITS > 7 && !code.empty() && code[0] != '0')
+            {
+                std::uint32_t short_value = 0;
+                if (const auto len = ParseShortDigits(first, last, short_value); len != 0)
+                {
+                    if (len == code.size())
+                    {
+                        HitEndOfInput();
+                    }
+                    out = static_cast<U>(short_value);
+                    code.remove_prefix(len);
+                    return true;
+                }
+            }
+
+            // leading zeros never overflow
+            std::size_t len = 0;
+            for (; len != code.size() && code[len] == '0'; ++len)
+            {
+            }
+
+            const auto digits = DigitSpan(first + len, last, DIGITS);
+            if (len + digits == code.size())
+            {
+                HitEndOfInput();
+            }
+            if (len + digits == 0)
+            {
+                return false;
+            }
+
+            const auto head  = digits < DIGITS ? digits : DIGITS - 1;
+            auto       value = ParseDigits<U>(first + len, head, last);
+            len += head;
+
+            if (digits == DIGITS)
+            {
+                const auto digit = static_cast<U>(code[len] - '0');
+                const bool fits  = value < Max / 10 || (value == Max / 10 && digit <= Max % 10);
+                value            = fits ? static_cast<U>(value * 10 + digit) : value;
+                len += fits;
+            }
+            // with `Max < 10` a first digit above `Max` takes nothing
+            if (len == 0)
+            {
+                return false;
+            }
+
+            out = value;
+            code.remove_prefix(len);
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return {CharSet::range('0', '9')};
+        }
+    };
+}  // namespace __impl
+
 // parse a given char
 constexpr auto ParseChar(char ch)
 {
-    return [ch](ParserInput code) -> ParserOutput<char> {
-        return (code.empty() || code[0] != ch) ?
-                   NONE :
-                   SOME(std::make_pair(ch, ParserInput(code.data() + 1, code.size() - 1)));
-    };
+    return __impl::CharParser(ch);
 }
 
 // parse a char in given set
+constexpr auto ParseOneOfChars(CharSet set)
+{
+    return __impl::CharSetParser(set);
+}
+
 constexpr auto ParseOneOfChars(std::string_view chs)
 {
-    return [chs](ParserInput code) -> ParserOutput<char> {
-        return (code.empty() || calgo::find(chs.cbegin(), chs.cend(), code[0]) == chs.cend()) ?
-                   NONE :
-                   SOME(std::make_pair(code[0], ParserInput(code.data() + 1, code.size() - 1)));
-    };
+    return ParseOneOfChars(CharSet(chs));
 }
 
 // parse a char not in given set
+constexpr auto ParseNoneOfChars(CharSet set)
+{
+    return ParseOneOfChars(~set);
+}
+
 constexpr auto ParseNoneOfChars(std::string_view chs)
 {
-    return [chs](ParserInput code) -> ParserOutput<char> {
-        return (code.empty() || calgo::find(chs.cbegin(), chs.cend(), code[0]) != chs.cend()) ?
-                   NONE :
-                   SOME(std::make_pair(code[0], ParserInput(code.data() + 1, code.size() - 1)));
-    };
+    return ParseNoneOfChars(CharSet(chs));
 }
 
 // parse a given string
 constexpr auto ParseString(std::string_view str)
 {
-    return [str](ParserInput code) -> ParserOutput<std::string_view> {
-        const auto pos = calgo::mismatch(str.cbegin(), str.cend(), code.cbegin(), code.cend());
-        if (pos.first == str.cend())
-        {
-            // match success
-            const auto len = calgo::distance(pos.second, code.cend());
-            return SOME(std::make_pair(str, ParserInput(pos.second, len)));
-        }
-        else
-        {
-            return NONE;
-        }
-    };
+    return __impl::StringParser(str);
+}
+
+// Parse a string literal given as a template argument, e.g. `ParseString<"GET">()`.
+// Its length is a constant, so the match is a few word compares: prefer it for keywords.
+template <__impl::Literal Str>
+constexpr auto ParseString()
+{
+    return __impl::LiteralParser<Str>();
+}
+
+// Parse the longest of the string literals given as template arguments, e.g. `ParseOneOfStrings<"in", "int">()`.
+// The strings are compiled into a trie, so unlike a `Choice` of `ParseString`s, no prefix is scanned twice.
+template <__impl::Literal... Strs>
+    requires(sizeof...(Strs) > 0)
+constexpr auto ParseOneOfStrings()
+{
+    return __impl::KeywordsParser<false, Strs...>();
+}
+
+// `ParseOneOfStrings`, which gives the index of the matched string in `Strs` instead.
+template <__impl::Literal... Strs>
+    requires(sizeof...(Strs) > 0)
+constexpr auto ParseIndexOfStrings()
+{
+    return __impl::KeywordsParser<true, Strs...>();
+}
+
+// parse the longest decimal number which does not exceed `Max`
+template <typename U, U Max = std::numeric_limits<U>::max()>
+    requires std::unsigned_integral<U>
+constexpr auto ParseDecimal()
+{
+    return __impl::DecimalParser<U, Max>();
 }
 
 // parse a escaped char
 constexpr auto ParseEscapeChar()
 {
     constexpr auto backslash_parser    = ParseChar('\\');
-    constexpr auto special_char_parser = ParseOneOfChars("abfnrtv'") || ParseChar('\\') || ParseChar('\"');
+    constexpr auto special_char_parser = Choice(ParseOneOfChars("abfnrtv'"), ParseChar('\\'), ParseChar('\"'));
 
     constexpr auto convert_special_char = [](char c) {
         switch (c)
@@ -102,32 +698,47 @@ constexpr auto ParseEscapeChar()
 
 constexpr auto ParseCStringChar()
 {
-    return ParseEscapeChar() || ParseNoneOfChars("\\\"");
+    return Choice(ParseEscapeChar(), ParseNoneOfChars("\\\""));
 }
 
 template <std::size_t Capacity = 128>
 constexpr auto ParseCString()
 {
-    return Many(ParseCStringChar(), StaticString<char, Capacity>(), [](auto acc, auto ch) {
-        acc.push_back(ch);
-        return acc;
-    });
+    return Many(ParseCStringChar(), StaticString<char, Capacity>(), [](auto& acc, char ch) { acc.push_back(ch); });
+}
+
+// `ParseCString` without a length limit, for runtime only: the chars go to an `ArenaString`, so the parse must run in
+// an `ArenaScope`, which the result must not outlive.
+constexpr auto ParseArenaCString()
+{
+    return Many(ParseCStringChar(), ArenaString<char>(), [](auto& acc, char ch) { acc.push_back(ch); });
 }
 
 inline namespace literals
 {
+    // [a-z]
+    constexpr auto lowercase_set = CharSet::range('a', 'z');
+
+    // [A-Z]
+    constexpr auto uppercase_set = CharSet::range('A', 'Z');
+
     // [a-zA-Z]
-    constexpr auto alphabet_parser = ParseOneOfChars("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"sv);
+    constexpr auto alphabet_set = lowercase_set | uppercase_set;
+
+    // [0-9]
+    constexpr auto digit_set = CharSet::range('0', '9');
+
+    // [a-zA-Z]
+    constexpr auto alphabet_parser = ParseOneOfChars(alphabet_set);
 
     // [a-z]
-    constexpr auto lowercase_parser = ParseOneOfChars("abcdefghijklmnopqrstuvwxyz"sv);
+    constexpr auto lowercase_parser = ParseOneOfChars(lowercase_set);
 
     // [A-Z]
-    constexpr auto uppercase_parser = ParseOneOfChars("ABCDEFGHIJKLMNOPQRSTUVWXYZ"sv);
+    constexpr auto uppercase_parser = ParseOneOfChars(uppercase_set);
 
     // [0-9]
-    constexpr auto digit_parser =
-        Map(ParseOneOfChars("0123456789"sv), [](char ch) { return static_cast<int>(ch - '0'); });
+    constexpr auto digit_parser = Map(ParseOneOfChars(digit_set), [](char ch) { return static_cast<int>(ch - '0'); });
 
     // Escape charactors
     constexpr auto escape_chara_parser = ParseEscapeChar();
@@ -144,21 +755,15 @@ inline namespace literals
 // parse a int32_value
 constexpr auto ParseInt32()
 {
-    constexpr std::int32_t INT32_MAX_DIV_10 = std::numeric_limits<std::int32_t>::max() / 10;
-    constexpr std::int32_t INT32_MAX_MOD_10 = std::numeric_limits<std::int32_t>::max() % 10;
-
-    constexpr auto abs_parser = [](std::int32_t limit_dig) {
-        return DoWhile(
-            digit_parser, static_cast<std::uint32_t>(0), [](std::uint32_t acc, int dig) { return acc * 10 + dig; },
-            [limit_dig](std::uint32_t acc, int dig) { return acc < INT32_MAX_DIV_10 || dig <= limit_dig; });
-    };
+    constexpr auto INT32_POS_LIMIT = static_cast<std::uint32_t>(std::numeric_limits<std::int32_t>::max());
+    constexpr auto INT32_NEG_LIMIT = INT32_POS_LIMIT + 1;
 
     constexpr auto neg_parser = Combine(
-        Map(ParseChar('-'), [](char _) { return -1; }), abs_parser(INT32_MAX_MOD_10 + 1),
+        Map(ParseChar('-'), [](char _) { return -1; }), ParseDecimal<std::uint32_t, INT32_NEG_LIMIT>(),
         [](int _, std::uint32_t val) { return static_cast<std::int32_t>(-1 * static_cast<std::int64_t>(val)); });
 
     constexpr auto pos_parser =
-        Combine(Try(Map(ParseChar('+'), [](char _) { return 1; }), 1), abs_parser(INT32_MAX_MOD_10),
+        Combine(Try(Map(ParseChar('+'), [](char _) { return 1; }), 1), ParseDecimal<std::uint32_t, INT32_POS_LIMIT>(),
                 [](int _, std::uint32_t val) { return static_cast<std::int32_t>(val); });
 
     // Only one of them will be satisfied, so choose any one of them is ok.
@@ -168,24 +773,18 @@ constexpr auto ParseInt32()
 // parse a int64_value
 constexpr auto ParseInt64()
 {
-    constexpr std::int64_t INT64_MAX_DIV_10 = std::numeric_limits<std::int64_t>::max() / 10;
-    constexpr std::int64_t INT64_MAX_MOD_10 = std::numeric_limits<std::int64_t>::max() % 10;
-
-    constexpr auto abs_parser = [](std::int64_t limit_dig) {
-        return DoWhile(
-            digit_parser, static_cast<std::uint64_t>(0), [](std::uint64_t acc, int dig) { return acc * 10 + dig; },
-            [limit_dig](std::uint64_t acc, int dig) { return acc < INT64_MAX_DIV_10 || dig <= limit_dig; });
-    };
+    constexpr auto INT64_POS_LIMIT = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    constexpr auto INT64_NEG_LIMIT = INT64_POS_LIMIT + 1;
 
     constexpr auto neg_parser = Combine(
-        Map(ParseChar('-'), [](char _) { return -1; }), abs_parser(INT64_MAX_MOD_10 + 1), [](int _, std::uint64_t val) {
-            return val == static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) + 1 ?
-                       std::numeric_limits<std::int64_t>::min() :
-                       -1 * static_cast<std::int64_t>(val);
+        Map(ParseChar('-'), [](char _) { return -1; }), ParseDecimal<std::uint64_t, INT64_NEG_LIMIT>(),
+        [](int _, std::uint64_t val) {
+            return val == INT64_NEG_LIMIT ? std::numeric_limits<std::int64_t>::min() :
+                                            -1 * static_cast<std::int64_t>(val);
         });
 
     constexpr auto pos_parser =
-        Combine(Try(Map(ParseChar('+'), [](char _) { return 1; }), 1), abs_parser(INT64_MAX_MOD_10),
+        Combine(Try(Map(ParseChar('+'), [](char _) { return 1; }), 1), ParseDecimal<std::uint64_t, INT64_POS_LIMIT>(),
                 [](int _, std::uint64_t val) { return static_cast<std::int64_t>(val); });
 
     // Only one of them will be satisfied, so choose any one of them is ok.
@@ -195,23 +794,13 @@ constexpr auto ParseInt64()
 // parse a uint32_t value
 constexpr auto ParseUint32()
 {
-    constexpr std::uint32_t UINT32_MAX_DIV_10 = std::numeric_limits<std::uint32_t>::max() / 10;
-    constexpr std::uint32_t UINT32_MAX_MOD_10 = std::numeric_limits<std::uint32_t>::max() % 10;
-
-    return DoWhile(
-        digit_parser, static_cast<std::uint32_t>(0), [](std::uint32_t acc, int dig) { return acc * 10 + dig; },
-        [](std::uint32_t acc, int dig) { return acc < UINT32_MAX_DIV_10 || dig <= UINT32_MAX_MOD_10; });
+    return ParseDecimal<std::uint32_t>();
 }
 
 // parse a uint64_t value
 constexpr auto ParseUint64()
 {
-    constexpr std::uint64_t UINT64_MAX_DEV_10 = std::numeric_limits<std::uint64_t>::max() / 10;
-    constexpr std::uint64_t UINT64_MAX_MOD_10 = std::numeric_limits<std::uint64_t>::max() % 10;
-
-    return DoWhile(
-        digit_parser, static_cast<std::uint64_t>(0), [](std::uint64_t acc, int dig) { return acc * 10 + dig; },
-        [](std::uint64_t acc, int dig) { return acc < UINT64_MAX_DEV_10 || dig <= UINT64_MAX_MOD_10; });
+    return ParseDecimal<std::uint64_t>();
 }
 
 inline namespace literals
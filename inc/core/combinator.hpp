@@ -1,16 +1,22 @@
 #pragma once
 
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
 
+#include "../utils/charset.hpp"
 #include "../utils/option.hpp"
 #include "./parser.hpp"
 
 using d1::core::parser::ParserInput;
 using d1::core::parser::ParserOutput;
+using d1::utils::charset::CharSet;
+using d1::utils::charset::CharSetScanner;
 using d1::utils::option::None;
 using d1::utils::option::NONE;
 using d1::utils::option::Some;
@@ -25,13 +31,234 @@ constexpr auto MODULE_NAME{"core/combinator.hpp"sv};
 
 namespace __impl
 {
+    using d1::core::parser::__impl::Discard;
+    using d1::core::parser::__impl::discards;
+    using d1::core::parser::__impl::FirstOf;
+    using d1::core::parser::__impl::FirstOfAlternative;
+    using d1::core::parser::__impl::FirstOfSequence;
+    using d1::core::parser::__impl::FirstSet;
+    using d1::core::parser::__impl::Get;
+    using d1::core::parser::__impl::HitEndOfInput;
     using d1::core::parser::__impl::ParsedMirType;
     using d1::core::parser::__impl::ParsedResultType;
-    using d1::utils::option::__impl::Overload;
+    using d1::core::parser::__impl::ParserBase;
+    using d1::core::parser::__impl::Run;
+    using d1::core::parser::__impl::Slot;
+
+    // a parser, lowered or not: it takes a `ParserInput` and returns an `Option` of a result and the rest
+    template <typename Parser>
+    concept parser_like = requires { typename ParsedResultType<std::decay_t<Parser>>; };
 
     template <typename Predicator, typename... Args>
     concept is_predicatable = std::same_as<std::invoke_result_t<Predicator, Args...>, bool>;
 
+    template <typename Parser1, typename Parser2, typename Fn>
+    using CombinedType = std::invoke_result_t<Fn, ParsedResultType<Parser1>, ParsedResultType<Parser2>>;
+
+    template <typename Parser1, typename Parser2, typename Fn>
+    class CombineParser : public ParserBase<CombineParser<Parser1, Parser2, Fn>, CombinedType<Parser1, Parser2, Fn>>
+    {
+    public:
+        constexpr CombineParser(const Parser1& parser1, const Parser2& parser2, const Fn& fn)
+            : _parser1(parser1), _parser2(parser2), _fn(fn)
+        {
+        }
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            auto rest = code;
+            if constexpr (discards<Out>)
+            {
+                if (!Run(_parser1, rest, out) || !Run(_parser2, rest, out))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                Slot<ParsedResultType<Parser1>> r1{};
+                Slot<ParsedResultType<Parser2>> r2{};
+                if (!Run(_parser1, rest, r1) || !Run(_parser2, rest, r2))
+                {
+                    return false;
+                }
+                out = _fn(std::move(Get(r1)), std::move(Get(r2)));
+            }
+            code = rest;
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return FirstOfSequence(FirstOf(_parser1), FirstOf(_parser2));
+        }
+
+    private:
+        Parser1 _parser1;
+        Parser2 _parser2;
+        Fn      _fn;
+    };
+
+    // Sequence two parsers and keep only one side's result, which is written to `out` directly.
+    // The other side runs as a recognizer, its result is never built.
+    template <typename Parser1, typename Parser2, bool KeepLeft>
+    class SelectParser
+        : public ParserBase<SelectParser<Parser1, Parser2, KeepLeft>,
+                            ParsedResultType<std::conditional_t<KeepLeft, Parser1, Parser2>>>
+    {
+    public:
+        constexpr SelectParser(const Parser1& parser1, const Parser2& parser2) : _parser1(parser1), _parser2(parser2)
+        {
+        }
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            auto rest = code;
+            Discard discard;
+            if constexpr (KeepLeft)
+            {
+                if (!Run(_parser1, rest, out) || !Run(_parser2, rest, discard))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if (!Run(_parser1, rest, discard) || !Run(_parser2, rest, out))
+                {
+                    return false;
+                }
+            }
+            code = rest;
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return FirstOfSequence(FirstOf(_parser1), FirstOf(_parser2));
+        }
+
+    private:
+        Parser1 _parser1;
+        Parser2 _parser2;
+    };
+
+    template <typename Parser1, typename Parser2>
+    class AlternativeParser : public ParserBase<AlternativeParser<Parser1, Parser2>, ParsedResultType<Parser1>>
+    {
+    public:
+        constexpr AlternativeParser(const Parser1& parser1, const Parser2& parser2)
+            : _parser1(parser1), _parser2(parser2)
+        {
+        }
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            return Run(_parser1, code, out) || Run(_parser2, code, out);
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return FirstOfAlternative(FirstOf(_parser1), FirstOf(_parser2));
+        }
+
+    private:
+        Parser1 _parser1;
+        Parser2 _parser2;
+    };
+
+    // The smallest unsigned integer with a bit per branch.
+    template <std::size_t N>
+    using BranchMask = std::conditional_t<
+        N <= 8, std::uint8_t,
+        std::conditional_t<N <= 16, std::uint16_t, std::conditional_t<N <= 32, std::uint32_t, std::uint64_t>>>;
+
+    // Ordered choice dispatched on the next byte.
+    // `_table[byte]` has bit `i` set iff branch `i` may succeed on an input starting with `byte` (by its `FirstSet`),
+    // and `_at_end` marks the branches which may succeed on an empty input. Only those branches are tried, in order.
+    template <typename... Parsers>
+    class ChoiceParser
+        : public ParserBase<ChoiceParser<Parsers...>, ParsedResultType<std::tuple_element_t<0, std::tuple<Parsers...>>>>
+    {
+        static constexpr std::size_t N = sizeof...(Parsers);
+
+        using Mask = BranchMask<N>;
+
+    public:
+        constexpr explicit ChoiceParser(const Parsers&... parsers) : _parsers(parsers...)
+        {
+            const auto firsts = std::array<FirstSet, N>{FirstOf(parsers)...};
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                const auto bit = static_cast<Mask>(Mask{1} << i);
+                _first         = FirstOfAlternative(_first, firsts[i]);
+                if (firsts[i].nullable)
+                {
+                    _at_end |= bit;
+                }
+                for (unsigned byte = 0; byte < _table.size(); ++byte)
+                {
+                    if (firsts[i].nullable || firsts[i].chars.contains(static_cast<char>(byte)))
+                    {
+                        _table[byte] |= bit;
+                    }
+                }
+            }
+        }
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            if (code.empty())
+            {
+                HitEndOfInput();
+            }
+            auto viable = code.empty() ? _at_end : _table[static_cast<unsigned char>(code[0])];
+            for (; viable != 0; viable &= viable - 1)
+            {
+                if (BRANCHES<Out>[std::countr_zero(viable)](_parsers, code, out))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return _first;
+        }
+
+    private:
+        template <typename Out>
+        using Branch = bool (*)(const std::tuple<Parsers...>&, ParserInput&, Out&);
+
+        template <std::size_t I, typename Out>
+        static constexpr bool RunBranch(const std::tuple<Parsers...>& parsers, ParserInput& code, Out& out)
+        {
+            return Run(std::get<I>(parsers), code, out);
+        }
+
+        template <typename Out, std::size_t... Is>
+        static constexpr std::array<Branch<Out>, N> MakeBranches(std::index_sequence<Is...>)
+        {
+            return {&RunBranch<Is, Out>...};
+        }
+
+        // the jump table from a branch index to the branch
+        template <typename Out>
+        static constexpr std::array<Branch<Out>, N> BRANCHES = MakeBranches<Out>(std::make_index_sequence<N>{});
+
+        std::tuple<Parsers...> _parsers;
+        std::array<Mask, 256>  _table{};
+        Mask                   _at_end{0};
+        FirstSet               _first{};
+    };
+
 }  // namespace __impl
 
 // The basic combinator of `Parser`: cascade
@@ -42,22 +269,7 @@ namespace __impl
 template <typename Parser1, typename Parser2, typename Fn>
 constexpr auto Combine(Parser1&& parser1, Parser2&& parser2, Fn&& fn)
 {
-    using Mir1 = __impl::ParsedMirType<Parser1>;
-    using T1   = __impl::ParsedResultType<Parser1>;
-    using Mir2 = __impl::ParsedMirType<Parser2>;
-    using T2   = __impl::ParsedResultType<Parser2>;
-    using R    = std::invoke_result_t<Fn, T1, T2>;
-
-    return [=](ParserInput code) -> ParserOutput<R> {
-        return parser1(code) >>= ([=](const Mir1& mir1) {
-                   return parser2(mir1.second) >>= [r1 = mir1.first](const Mir2& mir2) {
-                       return SOME(std::make_tuple(r1, mir2.first, mir2.second));
-                   };
-               } <<= [=](const auto& tuple1_2) -> ParserOutput<R> {
-                   const auto [r1, r2, code] = tuple1_2;
-                   return SOME(std::make_pair(fn(r1, r2), code));
-               });
-    };
+    return __impl::CombineParser<std::decay_t<Parser1>, std::decay_t<Parser2>, std::decay_t<Fn>>(parser1, parser2, fn);
 }
 
 // The basic combinator of `Parser`: shunt
@@ -68,102 +280,189 @@ template <typename Parser1, typename Parser2>
              std::same_as<__impl::ParsedResultType<Parser1>, __impl::ParsedResultType<Parser2>>
 constexpr auto operator||(Parser1&& parser1, Parser2&& parser2)
 {
-    using Mir = __impl::ParsedMirType<Parser1>;
-    using T   = __impl::ParsedResultType<Parser1>;
-
-    return [=](ParserInput code) -> ParserOutput<T> {
-        return std::visit(__impl::Overload{
-                              [](const Some<Mir>& mir) -> ParserOutput<T> { return mir; },
-                              [&](const None& _) -> ParserOutput<T> { return parser2(code); },
-                          },
-                          parser1(code).to_variant());
-    };
+    return __impl::AlternativeParser<std::decay_t<Parser1>, std::decay_t<Parser2>>(parser1, parser2);
 }
 
 // Select the first parser's result in a combined `Parser`
 //
 // operator << :: Parser a -> Parser b -> Parser a
 template <typename Parser1, typename Parser2>
+    requires __impl::parser_like<Parser1> && __impl::parser_like<Parser2>
 constexpr auto operator<<(Parser1&& parser1, Parser2&& parser2)
 {
-    return Combine(parser1, parser2, [](const auto& lhs, const auto& rhs) { return lhs; });
+    return __impl::SelectParser<std::decay_t<Parser1>, std::decay_t<Parser2>, true>(parser1, parser2);
 }
 
 // Select the right parser's result in a combined `Parser`
 //
 // operator >> :: Parser a -> Parser b -> Parser b
 template <typename Parser1, typename Parser2>
+    requires __impl::parser_like<Parser1> && __impl::parser_like<Parser2>
 constexpr auto operator>>(Parser1&& parser1, Parser2&& parser2)
 {
-    return Combine(parser1, parser2, [](const auto& lhs, const auto& rhs) { return rhs; });
+    return __impl::SelectParser<std::decay_t<Parser1>, std::decay_t<Parser2>, false>(parser1, parser2);
+}
+
+// Ordered choice among any number of parsers, with the same result as chaining them by `||`.
+// The possible first bytes of every branch are computed when the parser is built (at compile time for a constexpr
+// `Choice`), so at runtime the next byte selects the viable branches through a 256-entry table: branches which cannot
+// match are never run, and the dispatch costs the same however many branches there are.
+// Branches whose first bytes are unknown (e.g. user-defined lambdas) or which may match the empty input are always
+// tried. At most 64 branches.
+//
+// Choice :: Parser a -> Parser a -> ... -> Parser a
+template <typename Parser, typename... Parsers>
+    requires(sizeof...(Parsers) < 64) &&
+            (std::same_as<__impl::ParsedResultType<Parser>, __impl::ParsedResultType<Parsers>> && ...)
+constexpr auto Choice(Parser&& parser, Parsers&&... parsers)
+{
+    return __impl::ChoiceParser<std::decay_t<Parser>, std::decay_t<Parsers>...>(parser, parsers...);
 }
 
 namespace __impl
 {
-    // Fold :: Parser a -> b -> (b -> a -> b) -> ParserInput -> ParserOutput b
-    template <typename Parser, typename Acc, typename Fn>
-    constexpr auto Fold(Parser&& parser, ParserInput code, Acc acc, Fn&& fn)
+    // An accumulator fn in the form of `fn(b&, a)`, which mutates the accumulator in place instead of returning a new
+    // one. Prefer it for large accumulators such as `StaticString`: `acc = fn(acc, x)` copies the whole accumulator per
+    // element.
+    template <typename Fn, typename Acc, typename T>
+    concept inplace_accumulator = std::invocable<const Fn&, Acc&, const T&> &&
+                                  std::is_void_v<std::invoke_result_t<const Fn&, Acc&, const T&>>;
+
+    // Accumulate :: (b -> a -> b) | (b& -> a -> ()) -> b& -> a -> ()
+    template <typename Fn, typename Acc, typename T>
+    constexpr void Accumulate(const Fn& fn, Acc& acc, const T& value)
     {
-        while (true)
+        if constexpr (inplace_accumulator<Fn, Acc, T>)
+        {
+            fn(acc, value);
+        }
+        else
         {
-            const auto mir = parser(code);
+            acc = fn(acc, value);
+        }
+    }
 
-            if (mir.is_none())
-            {
-                return SOME(std::make_pair(acc, code));
-            }
-            else
+    template <typename Parser, typename T>
+    class TryParser : public ParserBase<TryParser<Parser, T>, T>
+    {
+    public:
+        constexpr TryParser(const Parser& parser, const T& default_value)
+            : _parser(parser), _default_value(default_value)
+        {
+        }
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            if (!Run(_parser, code, out))
             {
-                acc  = fn(acc, mir.unwrap().first);
-                code = mir.unwrap().second;
+                out = _default_value;
             }
+            return true;
         }
-    }
 
-    // Fold with exact times.
-    template <typename Parser, typename Acc, typename Fn>
-    constexpr auto FoldExactly(Parser&& parser, ParserInput code, Acc acc, std::size_t times, Fn&& fn)
+        constexpr FirstSet first() const noexcept
+        {
+            return {FirstOf(_parser).chars, true};
+        }
+
+    private:
+        Parser _parser;
+        T      _default_value;
+    };
+
+    // Fold the results of `Parser` into `Acc`.
+    // Apply `Parser` at least `Least` times (0 or 1), at most `times` times, while `Predicator` is satisfied.
+    template <typename Parser, typename Acc, typename Fn, typename Predicator, std::size_t Least>
+    class FoldParser : public ParserBase<FoldParser<Parser, Acc, Fn, Predicator, Least>, Acc>
     {
-        while (times != 0)
+    public:
+        constexpr FoldParser(const Parser& parser, const Acc& acc, const Fn& fn, const Predicator& predicator,
+                             std::size_t times = static_cast<std::size_t>(-1))
+            : _parser(parser), _acc(acc), _fn(fn), _predicator(predicator), _times(times)
         {
-            const auto mir = parser(code);
+        }
 
-            if (mir.is_none())
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            if constexpr (discards<Out> && std::same_as<Predicator, std::nullptr_t>)
+            {
+                // nothing to accumulate, only the number of items matters
+                auto        rest    = code;
+                std::size_t applied = 0;
+                for (; applied < _times && Run(_parser, rest, out); ++applied)
+                {
+                }
+                if (applied < Least)
+                {
+                    return false;
+                }
+                code = rest;
+                return true;
+            }
+            else if constexpr (discards<Out>)
             {
-                return SOME(std::make_pair(acc, code));
+                // the predicator looks at the values, so they are built aside
+                Slot<Acc> acc{};
+                return fold(code, acc);
             }
             else
             {
-                acc  = fn(acc, mir.unwrap().first);
-                code = mir.unwrap().second;
-                times -= 1;
+                return fold(code, out);
             }
         }
 
-        // if fold 0 times...
-        return SOME(std::make_pair(acc, code));
-    }
+        constexpr FirstSet first() const noexcept
+        {
+            const auto item = FirstOf(_parser);
+            return {item.chars, Least == 0 || item.nullable};
+        }
 
-    // Fold while the reduced result satisfy the condition.
-    template <typename Parser, typename Acc, typename Fn, typename Predicator>
-        requires is_predicatable<Predicator, Acc, ParsedResultType<Parser>>
-    constexpr auto FoldWhile(Parser&& parser, ParserInput code, Acc acc, Fn&& fn, Predicator&& predicator)
-    {
-        while (true)
+    private:
+        template <typename Out>
+        constexpr bool fold(ParserInput& code, Out& out) const
         {
-            const auto mir = parser(code);
+            auto                           rest = code;
+            Slot<ParsedResultType<Parser>> item{};
+
+            out       = _acc;
+            auto& acc = Get(out);
 
-            if (mir.is_some() && predicator(acc, mir.unwrap().first))
+            std::size_t applied = 0;
+            for (; applied < _times; ++applied)
             {
-                acc  = fn(acc, mir.unwrap().first);
-                code = mir.unwrap().second;
+                auto next = rest;
+                if (!Run(_parser, next, item))
+                {
+                    break;
+                }
+                if constexpr (!std::same_as<Predicator, std::nullptr_t>)
+                {
+                    // the first application of `DoWhile` is unconditional
+                    if ((Least == 0 || applied != 0) && !_predicator(acc, Get(item)))
+                    {
+                        break;
+                    }
+                }
+                Accumulate(_fn, acc, Get(item));
+                rest = next;
             }
-            else
+
+            if (applied < Least)
             {
-                return SOME(std::make_pair(acc, code));
+                return false;
             }
+            code = rest;
+            return true;
         }
-    }
+
+        Parser      _parser;
+        Acc         _acc;
+        Fn          _fn;
+        Predicator  _predicator;
+        std::size_t _times;
+    };
 
 }  // namespace __impl
 
@@ -173,26 +472,20 @@ namespace __impl
 template <typename Parser, typename T = __impl::ParsedResultType<Parser>>
 constexpr auto Try(Parser&& parser, T&& default_value)
 {
-    using Mir = __impl::ParsedMirType<Parser>;
-
-    return [=](ParserInput code) -> ParserOutput<T> {
-        return std::visit(
-            __impl::Overload{
-                [](const Some<Mir>& mir) -> ParserOutput<T> { return Option(mir); },
-                [&](const None& _) -> ParserOutput<T> { return SOME(std::make_pair(default_value, code)); },
-            },
-            parser(code).to_variant());
-    };
+    return __impl::TryParser<std::decay_t<Parser>, std::decay_t<T>>(parser, default_value);
 }
 
 // Apply * of a parser, then accumulate the results.
+// `fn` may also be in the form of `b& -> a -> ()` to accumulate in place, so do `Many`, `While`, `DoWhile` and
+// `Exactly`.
 //
 // Fn :: b -> a -> b
 // Any :: Parser a -> b -> (b -> a -> b) -> Parser b
 template <typename Parser, typename Acc = __impl::ParsedResultType<Parser>, typename Fn>
 constexpr auto Any(Parser&& parser, Acc&& acc, Fn&& fn)
 {
-    return [=](ParserInput code) -> ParserOutput<Acc> { return __impl::Fold(parser, code, acc, fn); };
+    return __impl::FoldParser<std::decay_t<Parser>, std::decay_t<Acc>, std::decay_t<Fn>, std::nullptr_t, 0>(
+        parser, acc, fn, nullptr);
 };
 
 // Apply + of a parser, then accumulate the results.
@@ -202,12 +495,8 @@ constexpr auto Any(Parser&& parser, Acc&& acc, Fn&& fn)
 template <typename Parser, typename Acc = __impl::ParsedResultType<Parser>, typename Fn>
 constexpr auto Many(Parser&& parser, Acc&& acc, Fn&& fn)
 {
-    using Mir = __impl::ParsedMirType<Parser>;
-
-    return [=](ParserInput code) -> ParserOutput<Acc> {
-        return parser(code) >>=
-               [=](const Mir& mir) { return __impl::Fold(parser, mir.second, fn(acc, mir.first), fn); };
-    };
+    return __impl::FoldParser<std::decay_t<Parser>, std::decay_t<Acc>, std::decay_t<Fn>, std::nullptr_t, 1>(
+        parser, acc, fn, nullptr);
 }
 
 // Apply * of a parser while condition satisfied, then accumulate the results.
@@ -219,7 +508,8 @@ template <typename Parser, typename Acc = __impl::ParsedResultType<Parser>, type
     requires __impl::is_predicatable<Predicator, Acc, __impl::ParsedResultType<Parser>>
 constexpr auto While(Parser&& parser, Acc&& acc, Fn&& fn, Predicator&& predicator)
 {
-    return [=](ParserInput code) -> ParserOutput<Acc> { return __impl::FoldWhile(parser, code, acc, fn, predicator); };
+    return __impl::FoldParser<std::decay_t<Parser>, std::decay_t<Acc>, std::decay_t<Fn>, std::decay_t<Predicator>, 0>(
+        parser, acc, fn, predicator);
 }
 
 // Apply + of a parser while condition satisfied, then accumulate the results.
@@ -232,13 +522,8 @@ template <typename Parser, typename Acc = __impl::ParsedResultType<Parser>, type
     requires __impl::is_predicatable<Predicator, Acc, __impl::ParsedResultType<Parser>>
 constexpr auto DoWhile(Parser&& parser, Acc&& acc, Fn&& fn, Predicator&& predicator)
 {
-    using Mir = __impl::ParsedMirType<Parser>;
-
-    return [=](ParserInput code) -> ParserOutput<Acc> {
-        return parser(code) >>= [=](const Mir& mir) {
-            return __impl::FoldWhile(parser, mir.second, fn(acc, mir.first), fn, predicator);
-        };
-    };
+    return __impl::FoldParser<std::decay_t<Parser>, std::decay_t<Acc>, std::decay_t<Fn>, std::decay_t<Predicator>, 1>(
+        parser, acc, fn, predicator);
 }
 
 // Apply a parser exactly n times, then accumulate the results.
@@ -248,7 +533,130 @@ constexpr auto DoWhile(Parser&& parser, Acc&& acc, Fn&& fn, Predicator&& predica
 template <typename Parser, typename Acc = __impl::ParsedResultType<Parser>, typename Fn>
 constexpr auto Exactly(Parser&& parser, Acc&& acc, std::size_t times, Fn&& fn)
 {
-    return [=](ParserInput code) -> ParserOutput<Acc> { return __impl::FoldExactly(parser, code, acc, times, fn); };
+    return __impl::FoldParser<std::decay_t<Parser>, std::decay_t<Acc>, std::decay_t<Fn>, std::nullptr_t, 0>(
+        parser, acc, fn, nullptr, times);
+}
+
+namespace __impl
+{
+    // Slice the longest run of chars in a set, which must be at least `Least` chars long.
+    template <std::size_t Least>
+    class TakeWhileParser : public ParserBase<TakeWhileParser<Least>, std::string_view>
+    {
+    public:
+        constexpr explicit TakeWhileParser(const CharSet& set) : _scanner(set) {}
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            const auto end = _scanner.span(code.data(), code.data() + code.size());
+            const auto len = static_cast<std::size_t>(end - code.data());
+            if (len == code.size())
+            {
+                HitEndOfInput();
+            }
+            if (len < Least)
+            {
+                return false;
+            }
+            out = code.substr(0, len);
+            code.remove_prefix(len);
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return {_scanner.set(), Least == 0};
+        }
+
+    private:
+        CharSetScanner _scanner;
+    };
+}  // namespace __impl
+
+// Consume the longest prefix whose chars are all in the given set, and return it as a slice of the input.
+// No per-char parser call and no accumulator: the run is found by `CharSetScanner`, so it is SIMD at runtime.
+// Never fails, an empty slice is returned if the first char is not in the set.
+//
+// TakeWhile :: CharSet -> Parser std::string_view
+constexpr auto TakeWhile(CharSet set)
+{
+    return __impl::TakeWhileParser<0>(set);
+}
+
+constexpr auto TakeWhile(std::string_view chs)
+{
+    return TakeWhile(CharSet(chs));
+}
+
+// Like `TakeWhile`, but fails if the slice would be empty.
+//
+// TakeWhile1 :: CharSet -> Parser std::string_view
+constexpr auto TakeWhile1(CharSet set)
+{
+    return __impl::TakeWhileParser<1>(set);
+}
+
+constexpr auto TakeWhile1(std::string_view chs)
+{
+    return TakeWhile1(CharSet(chs));
+}
+
+// Consume chars until one of the given set (or the end of input) is met. The terminator is not consumed.
+//
+// TakeUntil :: CharSet -> Parser std::string_view
+constexpr auto TakeUntil(CharSet set)
+{
+    return TakeWhile(~set);
+}
+
+constexpr auto TakeUntil(std::string_view chs)
+{
+    return TakeUntil(CharSet(chs));
+}
+
+namespace __impl
+{
+    template <typename Parser>
+    class RecognizeParser : public ParserBase<RecognizeParser<Parser>, std::string_view>
+    {
+    public:
+        constexpr explicit RecognizeParser(const Parser& parser) : _parser(parser) {}
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            auto    rest = code;
+            Discard discard;
+            if (!Run(_parser, rest, discard))
+            {
+                return false;
+            }
+            out  = code.substr(0, code.size() - rest.size());
+            code = rest;
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return FirstOf(_parser);
+        }
+
+    private:
+        Parser _parser;
+    };
+}  // namespace __impl
+
+// Run a parser only to match: the result is the consumed input, and the results of the parser and of the parsers it is
+// made of are not built, e.g. `Map` functions are not called and `Many` accumulates nothing (but for `While` and
+// `DoWhile`, whose predicator needs the values). For validation or skipping, and to slice tokens out of the input.
+// Parsers which are not lowered (e.g. user-defined lambdas) and `AnyParser` still build their own result.
+//
+// Recognize :: Parser a -> Parser std::string_view
+template <typename Parser>
+constexpr auto Recognize(Parser&& parser)
+{
+    return __impl::RecognizeParser<std::decay_t<Parser>>(parser);
 }
 
 namespace operators
@@ -258,4 +666,12 @@ namespace operators
     using d1::core::combinator::operator>>;
 }  // namespace operators
 
-}  // namespace d1::core::combinator
\ No newline at end of file
+}  // namespace d1::core::combinator
+
+// Every lowered parser derives from `ParserBase`, so the operators are found by ADL wherever the parsers are used.
+namespace d1::core::parser::__impl
+{
+using d1::core::combinator::operator||;
+using d1::core::combinator::operator<<;
+using d1::core::combinator::operator>>;
+}  // namespace d1::core::parser::__impl
\ No newline at end of file
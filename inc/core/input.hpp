@@ -0,0 +1,268 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../utils/option.hpp"
+#include "./parser.hpp"
+
+using d1::core::parser::ParserInput;
+using d1::utils::option::NONE;
+using d1::utils::option::Option;
+using d1::utils::option::SOME;
+
+namespace d1::core::input
+{
+using namespace std::literals;
+
+constexpr auto MODULE_NAME{"core/input.hpp"sv};
+
+// How a mapped file is going to be read, passed to the kernel by `madvise()`.
+enum class MapAccess
+{
+    Normal,
+    Sequential,  // aggressive read-ahead, pages behind may be dropped early
+    Random,      // no read-ahead
+};
+
+struct MapOptions
+{
+    MapAccess access{MapAccess::Sequential};
+
+    // start reading the whole file in ahead (`MADV_WILLNEED`)
+    bool will_need{true};
+
+    // Ask for transparent huge pages (`MADV_HUGEPAGE`), fewer TLB misses on multi-gigabyte inputs.
+    // Best effort: only honored by kernels which support huge pages for the page cache, ignored otherwise.
+    bool huge_pages{false};
+};
+
+namespace __impl
+{
+    using d1::core::parser::__impl::Get;
+    using d1::core::parser::__impl::ParsedResultType;
+    using d1::core::parser::__impl::Run;
+    using d1::core::parser::__impl::Slot;
+
+    // Whether a parsed value may point into the input: a `std::string_view` slice, or a pair, tuple, option or container
+    // of them.
+    template <typename T>
+    struct RefersIntoInput : std::false_type
+    {
+    };
+
+    template <typename T>
+        requires requires { typename T::value_type; }
+    struct RefersIntoInput<T> : RefersIntoInput<typename T::value_type>
+    {
+    };
+
+    template <typename Char, typename Traits>
+    struct RefersIntoInput<std::basic_string_view<Char, Traits>> : std::true_type
+    {
+    };
+
+    template <typename T, std::size_t Extent>
+    struct RefersIntoInput<std::span<T, Extent>> : std::true_type
+    {
+    };
+
+    template <typename... Ts>
+    struct RefersIntoInput<std::pair<Ts...>> : std::disjunction<RefersIntoInput<Ts>...>
+    {
+    };
+
+    template <typename... Ts>
+    struct RefersIntoInput<std::tuple<Ts...>> : std::disjunction<RefersIntoInput<Ts>...>
+    {
+    };
+
+    template <typename T>
+    struct RefersIntoInput<Option<T>> : RefersIntoInput<T>
+    {
+    };
+
+    template <typename T>
+    concept refers_into_input = RefersIntoInput<std::remove_cvref_t<T>>::value;
+
+    [[noreturn]] inline void ThrowErrno(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    inline int AdviceOf(MapAccess access) noexcept
+    {
+        switch (access)
+        {
+            case MapAccess::Sequential: return MADV_SEQUENTIAL;
+            case MapAccess::Random: return MADV_RANDOM;
+            case MapAccess::Normal: break;
+        }
+        return MADV_NORMAL;
+    }
+}  // namespace __impl
+
+// A file mapped read-only into memory, parsed in place as a `ParserInput`: no read into a buffer, no copy, and the
+// pages are loaded (and may be evicted) by the kernel as the parser goes.
+// Mapping has a fixed cost (the syscalls and page faults), so it pays off on large files rather than small ones.
+// Move-only, the mapping lives as long as the object, so do the views into it.
+// Throws `std::system_error` if the file can not be opened or mapped.
+class MappedInput
+{
+public:
+    explicit MappedInput(const std::filesystem::path& path, const MapOptions& options = {})
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            __impl::ThrowErrno("open");
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            const auto error = errno;
+            ::close(fd);
+            errno = error;
+            __impl::ThrowErrno("fstat");
+        }
+
+        _size = static_cast<std::size_t>(st.st_size);
+        if (_size != 0)
+        {
+            void* data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                const auto error = errno;
+                ::close(fd);
+                errno = error;
+                __impl::ThrowErrno("mmap");
+            }
+            _data = static_cast<const char*>(data);
+            advise(options);
+        }
+        // the mapping keeps the file alive
+        ::close(fd);
+    }
+
+    MappedInput(const MappedInput&)            = delete;
+    MappedInput& operator=(const MappedInput&) = delete;
+
+    MappedInput(MappedInput&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0))
+    {
+    }
+
+    MappedInput& operator=(MappedInput&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    ~MappedInput()
+    {
+        unmap();
+    }
+
+    const char* data() const noexcept
+    {
+        return _data;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    ParserInput view() const noexcept
+    {
+        return {_data, _size};
+    }
+
+    operator ParserInput() const noexcept
+    {
+        return view();
+    }
+
+    // Drop the pages wholly before `pos` (a position in `view()`) from this process, to bound the resident set while
+    // streaming through a large file. They are read back from the file if touched again.
+    void discard_before(const char* pos) noexcept
+    {
+        const auto page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const auto bytes = static_cast<std::size_t>(pos - _data) / page * page;
+        if (bytes != 0)
+        {
+            ::madvise(const_cast<char*>(_data), bytes, MADV_DONTNEED);
+        }
+    }
+
+private:
+    void advise(const MapOptions& options) noexcept
+    {
+        // hints only, a failure changes nothing but the performance
+        auto* data = const_cast<char*>(_data);
+        ::madvise(data, _size, __impl::AdviceOf(options.access));
+        if (options.will_need)
+        {
+            ::madvise(data, _size, MADV_WILLNEED);
+        }
+#if defined(MADV_HUGEPAGE)
+        if (options.huge_pages)
+        {
+            ::madvise(data, _size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    void unmap() noexcept
+    {
+        if (_data != nullptr)
+        {
+            ::munmap(const_cast<char*>(_data), _size);
+        }
+    }
+
+    const char* _data{nullptr};
+    std::size_t _size{0};
+};
+
+// Map a file and run a parser over it.
+// The mapping is released before returning, so the result is the parsed value and the number of bytes consumed. A
+// parser whose value may refer into the input (e.g. a `std::string_view` slice) does not compile: run it over a
+// `MappedInput` kept alive as long as the value.
+//
+// ParseFile :: Parser a -> Path -> Option (a, std::size_t)
+template <typename Parser, typename T = __impl::ParsedResultType<Parser>>
+    requires(!__impl::refers_into_input<T>)
+Option<std::pair<T, std::size_t>> ParseFile(const Parser& parser, const std::filesystem::path& path,
+                                            const MapOptions& options = {})
+{
+    const auto input = MappedInput(path, options);
+    auto       code  = input.view();
+
+    __impl::Slot<T> out{};
+    if (!__impl::Run(parser, code, out))
+    {
+        return NONE;
+    }
+    return SOME(std::make_pair(std::move(__impl::Get(out)), input.size() - code.size()));
+}
+
+}  // namespace d1::core::input
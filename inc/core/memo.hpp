@@ -0,0 +1,373 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./parser.hpp"
+
+using d1::core::parser::ParserInput;
+using d1::core::parser::ParserOutput;
+
+namespace d1::core::memo
+{
+using namespace std::literals;
+
+constexpr auto MODULE_NAME{"core/memo.hpp"sv};
+
+// Counters of a `MemoTable`.
+// A failed parse consumes nothing, so only successful parses are counted as scanned bytes.
+struct MemoStats
+{
+    std::size_t evaluations{0};      // times a memoized parser actually ran
+    std::size_t reevaluations{0};    // ... at a position where it already ran
+    std::size_t hits{0};             // times the result was taken from the table instead
+    std::size_t scanned_bytes{0};    // bytes consumed by the runs
+    std::size_t rescanned_bytes{0};  // ... at a position where the same parser already ran
+    std::size_t saved_bytes{0};      // bytes the hits would have re-scanned
+
+    // The re-scanned bytes of the same parse without memoization.
+    constexpr std::size_t rescanned_bytes_without_memo() const noexcept
+    {
+        return rescanned_bytes + saved_bytes;
+    }
+};
+
+namespace __impl
+{
+    using d1::core::parser::__impl::FirstOf;
+    using d1::core::parser::__impl::FirstSet;
+    using d1::core::parser::__impl::end_of_input_hit;
+    using d1::core::parser::__impl::Get;
+    using d1::core::parser::__impl::HitEndOfInput;
+    using d1::core::parser::__impl::ParsedResultType;
+    using d1::core::parser::__impl::ParserBase;
+    using d1::core::parser::__impl::Run;
+    using d1::core::parser::__impl::Slot;
+
+    enum class EntryState : std::uint8_t
+    {
+        Unknown,
+        Failed,
+        Parsed,
+    };
+
+    class ColumnBase
+    {
+    public:
+        virtual ~ColumnBase() = default;
+
+        // drop the entries of positions with more than `remaining` bytes left
+        virtual void truncate(std::size_t remaining) = 0;
+
+        virtual void clear() = 0;
+
+        virtual std::size_t size() const = 0;
+    };
+
+    // The results of one memoized parser, indexed by the remaining input size of the position they were parsed at.
+    // All the suffixes of an input share its end, so the remaining size identifies a position.
+    // Only the positions between the first and the last one looked up since the latest cut are stored: the column
+    // grows at either end as positions are looked up, and a cut drops its front. Its size is bounded by the distance
+    // the grammar looks ahead of a cut, not by the input size.
+    template <typename T>
+    class Column final : public ColumnBase
+    {
+    public:
+        struct Entry
+        {
+            EntryState  state{EntryState::Unknown};
+            bool        end{false};  // the result depends on the input past its end, see `HitEndOfInput()`
+            std::size_t rest{0};
+            Slot<T>     value{};
+        };
+
+        Entry& at(std::size_t remaining)
+        {
+            if (_entries.empty())
+            {
+                _front = remaining;
+            }
+            else if (remaining > _front)
+            {
+                _entries.insert(_entries.begin(), remaining - _front, Entry{});
+                _front = remaining;
+            }
+            const auto index = _front - remaining;
+            if (index >= _entries.size())
+            {
+                _entries.resize(index + 1);
+            }
+            return _entries[index];
+        }
+
+        void truncate(std::size_t remaining) override
+        {
+            if (_entries.empty() || _front <= remaining)
+            {
+                return;
+            }
+            const auto dropped = _front - remaining;
+            _entries.erase(_entries.begin(), _entries.begin() + std::min(dropped, _entries.size()));
+            _front = remaining;
+        }
+
+        void clear() override
+        {
+            _entries.clear();
+        }
+
+        std::size_t size() const override
+        {
+            return _entries.size();
+        }
+
+    private:
+        std::deque<Entry> _entries;
+        std::size_t       _front{0};  // the remaining size of `_entries.front()`
+    };
+}  // namespace __impl
+
+// The packrat table shared by the `Memo` and `Cut` parsers of one grammar.
+// It binds itself to the input it sees, parsing an input which ends elsewhere drops every entry first. An input which
+// reuses the buffer of the previous one up to its end (e.g. `std::getline` into the same string) cannot be told apart
+// from it: call `begin()` before each parse when buffers are reused.
+// With `caching` disabled, results are still recorded (to count re-scans) but never reused.
+class MemoTable
+{
+public:
+    explicit MemoTable(bool caching = true) : _caching(caching) {}
+
+    MemoTable(const MemoTable&)            = delete;
+    MemoTable& operator=(const MemoTable&) = delete;
+
+    bool caching() const noexcept
+    {
+        return _caching;
+    }
+
+    const MemoStats& stats() const noexcept
+    {
+        return _stats;
+    }
+
+    // live entries, over all the memoized parsers
+    std::size_t size() const
+    {
+        std::size_t size = 0;
+        for (const auto& column : _columns)
+        {
+            size += column->size();
+        }
+        return size;
+    }
+
+    // Drop the entries behind `code`. Parsers must not backtrack before it afterwards.
+    void cut(ParserInput code)
+    {
+        for (auto& column : _columns)
+        {
+            column->truncate(code.size());
+        }
+    }
+
+    // Start the parse of `input`: drop every entry, even if `input` is in the buffer of the previous parse.
+    void begin(ParserInput input)
+    {
+        clear();
+        _end = input.data() + input.size();
+    }
+
+    // Drop every entry. The stats are kept, they accumulate over parses until `reset_stats()`.
+    void clear()
+    {
+        for (auto& column : _columns)
+        {
+            column->clear();
+        }
+        _end = nullptr;
+    }
+
+    void reset_stats() noexcept
+    {
+        _stats = MemoStats{};
+    }
+
+    /* for `Memo` */
+    template <typename T>
+    std::size_t add_column()
+    {
+        _columns.push_back(std::make_unique<__impl::Column<T>>());
+        return _columns.size() - 1;
+    }
+
+    template <typename T>
+    __impl::Column<T>& column(std::size_t id)
+    {
+        return static_cast<__impl::Column<T>&>(*_columns[id]);
+    }
+
+    void bind(ParserInput code)
+    {
+        const auto end = code.data() + code.size();
+        if (end != _end)
+        {
+            for (auto& column : _columns)
+            {
+                column->clear();
+            }
+            _end = end;
+        }
+    }
+
+    MemoStats& mutable_stats() noexcept
+    {
+        return _stats;
+    }
+
+private:
+    std::vector<std::unique_ptr<__impl::ColumnBase>> _columns;
+    const char*                                      _end{nullptr};
+    MemoStats                                        _stats;
+    bool                                             _caching;
+};
+
+namespace __impl
+{
+    template <typename Parser>
+    class MemoParser : public ParserBase<MemoParser<Parser>, ParsedResultType<Parser>>
+    {
+    public:
+        using T = ParsedResultType<Parser>;
+
+        MemoParser(MemoTable& table, const Parser& parser)
+            : _parser(parser), _table(&table), _id(table.add_column<T>())
+        {
+        }
+
+        template <typename Out>
+        bool parse(ParserInput& code, Out& out) const
+        {
+            _table->bind(code);
+
+            auto&      stats     = _table->mutable_stats();
+            const auto remaining = code.size();
+            const auto state     = _table->column<T>(_id).at(remaining).state;
+
+            if (state != EntryState::Unknown && _table->caching())
+            {
+                auto& entry = _table->column<T>(_id).at(remaining);
+                stats.hits += 1;
+                if (entry.end)
+                {
+                    HitEndOfInput();
+                }
+                if (state == EntryState::Failed)
+                {
+                    return false;
+                }
+                stats.saved_bytes += remaining - entry.rest;
+                out = Get(entry.value);
+                code.remove_prefix(remaining - entry.rest);
+                return true;
+            }
+
+            // record whether this very run hits the end, and keep what the enclosing parse hit so far
+            const auto outer_end = std::exchange(end_of_input_hit, false);
+
+            Slot<T>    value{};
+            auto       rest   = code;
+            const auto parsed = Run(_parser, rest, value);
+            const auto bytes  = parsed ? remaining - rest.size() : 0;
+            const auto end    = std::exchange(end_of_input_hit, outer_end || end_of_input_hit);
+
+            stats.evaluations += 1;
+            stats.scanned_bytes += bytes;
+            if (state != EntryState::Unknown)
+            {
+                stats.reevaluations += 1;
+                stats.rescanned_bytes += bytes;
+            }
+
+            // the inner parser may have grown the column, look the entry up again
+            auto& entry = _table->column<T>(_id).at(remaining);
+            entry.state = parsed ? EntryState::Parsed : EntryState::Failed;
+            entry.end   = end;
+            if (!parsed)
+            {
+                return false;
+            }
+            entry.rest  = rest.size();
+            entry.value = Get(value);
+            out         = std::move(Get(value));
+            code        = rest;
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return FirstOf(_parser);
+        }
+
+    private:
+        Parser      _parser;
+        MemoTable*  _table;
+        std::size_t _id;
+    };
+
+    template <typename Parser>
+    class CutParser : public ParserBase<CutParser<Parser>, ParsedResultType<Parser>>
+    {
+    public:
+        CutParser(MemoTable& table, const Parser& parser) : _parser(parser), _table(&table) {}
+
+        template <typename Out>
+        bool parse(ParserInput& code, Out& out) const
+        {
+            if (!Run(_parser, code, out))
+            {
+                return false;
+            }
+            _table->cut(code);
+            return true;
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return FirstOf(_parser);
+        }
+
+    private:
+        Parser     _parser;
+        MemoTable* _table;
+    };
+}  // namespace __impl
+
+// Packrat memoization: cache the results of a parser by input position in the given table, so the alternatives of a
+// backtracking grammar which share a prefix parse it only once.
+// Left recursion is not supported.
+//
+// Memo :: MemoTable -> Parser a -> Parser a
+template <typename Parser>
+auto Memo(MemoTable& table, Parser&& parser)
+{
+    return __impl::MemoParser<std::decay_t<Parser>>(table, parser);
+}
+
+// A commit point: once the parser succeeds, the grammar never backtracks before its end, so the table frees every
+// entry behind it.
+//
+// Cut :: MemoTable -> Parser a -> Parser a
+template <typename Parser>
+auto Cut(MemoTable& table, Parser&& parser)
+{
+    return __impl::CutParser<std::decay_t<Parser>>(table, parser);
+}
+
+}  // namespace d1::core::memo
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../utils/option.hpp"
+#include "./parser.hpp"
+
+using d1::core::parser::ParserInput;
+using d1::utils::option::NONE;
+using d1::utils::option::Option;
+using d1::utils::option::SOME;
+
+namespace d1::core::parallel
+{
+using namespace std::literals;
+
+constexpr auto MODULE_NAME{"core/parallel.hpp"sv};
+
+struct ParallelOptions
+{
+    // worker threads, the calling thread included; 0 for `std::thread::hardware_concurrency()`
+    std::size_t threads{0};
+
+    // The input is split into chunks of about this size, parsed one at a time by a thread. Smaller inputs get smaller
+    // chunks (down to 64 KiB), several per thread, so that idle threads have chunks to steal from busy ones.
+    std::size_t chunk_size{1 << 20};
+};
+
+namespace __impl
+{
+    using d1::core::parser::__impl::Get;
+    using d1::core::parser::__impl::ParsedResultType;
+    using d1::core::parser::__impl::Run;
+    using d1::core::parser::__impl::Slot;
+
+    constexpr std::size_t MIN_CHUNK        = 1 << 16;
+    constexpr std::size_t TASKS_PER_THREAD = 8;
+
+    // The first record boundary at or after `pos`: the input's ends, or just past a delimiter.
+    inline std::size_t Resync(ParserInput input, std::size_t pos, char delimiter) noexcept
+    {
+        if (pos == 0 || pos >= input.size())
+        {
+            return std::min(pos, input.size());
+        }
+        if (input[pos - 1] == delimiter)
+        {
+            return pos;
+        }
+        const auto next = input.find(delimiter, pos);
+        return next == ParserInput::npos ? input.size() : next + 1;
+    }
+
+    // The tasks [begin, end) left to a worker, packed in one word so both ends move by a single CAS: the owner pops
+    // from the front, thieves take the back half.
+    // Tasks are never added back, so a packed value never repeats and there is no ABA.
+    class alignas(64) TaskRange
+    {
+    public:
+        void assign(std::uint32_t begin, std::uint32_t end) noexcept
+        {
+            _range.store(Pack(begin, end), std::memory_order_release);
+        }
+
+        bool pop(std::uint32_t& task) noexcept
+        {
+            auto range = _range.load(std::memory_order_acquire);
+            while (Begin(range) < End(range))
+            {
+                if (_range.compare_exchange_weak(range, Pack(Begin(range) + 1, End(range)), std::memory_order_acq_rel))
+                {
+                    task = Begin(range);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool steal(std::uint32_t& begin, std::uint32_t& end) noexcept
+        {
+            auto range = _range.load(std::memory_order_acquire);
+            while (Begin(range) < End(range))
+            {
+                const auto mid = End(range) - (End(range) - Begin(range) + 1) / 2;
+                if (_range.compare_exchange_weak(range, Pack(Begin(range), mid), std::memory_order_acq_rel))
+                {
+                    begin = mid;
+                    end   = End(range);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        static constexpr std::uint64_t Pack(std::uint32_t begin, std::uint32_t end) noexcept
+        {
+            return (std::uint64_t{begin} << 32) | end;
+        }
+
+        static constexpr std::uint32_t Begin(std::uint64_t range) noexcept
+        {
+            return static_cast<std::uint32_t>(range >> 32);
+        }
+
+        static constexpr std::uint32_t End(std::uint64_t range) noexcept
+        {
+            return static_cast<std::uint32_t>(range);
+        }
+
+        std::atomic<std::uint64_t> _range{0};
+    };
+
+    // Run `task(index)` for every index in [0, tasks) on `threads` threads, the calling one included.
+    // Each thread starts on a contiguous block of tasks, for locality, and steals from the others once it is done.
+    // Returns false as soon as a task does; the first exception thrown by a task is rethrown.
+    template <typename Task>
+    bool RunTasks(std::size_t tasks, std::size_t threads, const Task& task)
+    {
+        std::vector<TaskRange> ranges(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+        {
+            ranges[i].assign(static_cast<std::uint32_t>(tasks * i / threads),
+                             static_cast<std::uint32_t>(tasks * (i + 1) / threads));
+        }
+
+        std::atomic<bool>  failed{false};
+        std::exception_ptr error;
+        std::mutex         error_mutex;
+
+        const auto worker = [&](std::size_t self) {
+            try
+            {
+                std::uint32_t next = 0;
+                std::uint32_t end  = 0;
+                while (!failed.load(std::memory_order_relaxed))
+                {
+                    if (!ranges[self].pop(next))
+                    {
+                        std::size_t victim = 1;
+                        for (; victim < threads; ++victim)
+                        {
+                            if (ranges[(self + victim) % threads].steal(next, end))
+                            {
+                                ranges[self].assign(next + 1, end);
+                                break;
+                            }
+                        }
+                        if (victim == threads)
+                        {
+                            return;
+                        }
+                    }
+                    if (!task(next))
+                    {
+                        failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+            catch (...)
+            {
+                const std::lock_guard lock(error_mutex);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i)
+        {
+            pool.emplace_back(worker, i);
+        }
+        worker(0);
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+        return !failed.load();
+    }
+}  // namespace __impl
+
+// Parse every record of a delimited input (e.g. the lines of a log or of a CSV file) in parallel, with one parser call
+// per record, and return the results in the input's order; or `NONE` if a record does not parse to its end.
+// Empty records, e.g. blank lines, are skipped.
+//
+// The input is split into chunks which are moved to the next record boundary, so that each record is parsed by one
+// thread. The parsers are pure functions of their input, so any of them runs unchanged, as long as it holds no
+// mutable state: e.g. a `Memo` table must not be shared between threads.
+//
+// ParallelParse :: Parser a -> ParserInput -> char -> Option [a]
+template <typename Parser, typename T = __impl::ParsedResultType<Parser>>
+Option<std::vector<T>> ParallelParse(const Parser& parser, ParserInput input, char delimiter = '\n',
+                                     const ParallelOptions& options = {})
+{
+    const auto hardware = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    auto       threads  = std::max<std::size_t>(1, options.threads != 0 ? options.threads : hardware);
+
+    const auto balanced   = input.size() / (threads * __impl::TASKS_PER_THREAD) + 1;
+    const auto chunk_size = std::max({std::min(options.chunk_size, __impl::MIN_CHUNK),
+                                      std::min(options.chunk_size, balanced), input.size() / UINT32_MAX + 1});
+    const auto tasks      = std::max<std::size_t>(1, (input.size() + chunk_size - 1) / chunk_size);
+    threads               = std::min(threads, tasks);
+
+    std::vector<std::vector<T>> parts(tasks);
+    const auto                  parse_chunk = [&](std::size_t task) {
+        const auto first = __impl::Resync(input, task * chunk_size, delimiter);
+        const auto last  = __impl::Resync(input, (task + 1) * chunk_size, delimiter);
+
+        for (auto records = input.substr(first, last - first); !records.empty();)
+        {
+            const auto end    = std::min(records.find(delimiter), records.size());
+            auto       record = records.substr(0, end);
+            records.remove_prefix(std::min(end + 1, records.size()));
+            if (record.empty())
+            {
+                continue;
+            }
+
+            __impl::Slot<T> out{};
+            if (!__impl::Run(parser, record, out) || !record.empty())
+            {
+                return false;
+            }
+            parts[task].push_back(std::move(__impl::Get(out)));
+        }
+        return true;
+    };
+
+    if (!__impl::RunTasks(tasks, threads, parse_chunk))
+    {
+        return NONE;
+    }
+
+    std::size_t count = 0;
+    for (const auto& part : parts)
+    {
+        count += part.size();
+    }
+    std::vector<T> results;
+    results.reserve(count);
+    for (auto& part : parts)
+    {
+        std::move(part.begin(), part.end(), std::back_inserter(results));
+    }
+    return SOME(std::move(results));
+}
+
+}  // namespace d1::core::parallel
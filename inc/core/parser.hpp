@@ -1,12 +1,18 @@
 #pragma once
 
+#include <concepts>
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <optional>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 
+#include "../utils/charset.hpp"
 #include "../utils/option.hpp"
 
+using d1::utils::charset::CharSet;
 using d1::utils::option::NONE;
 using d1::utils::option::Option;
 using d1::utils::option::SOME;
@@ -30,12 +36,470 @@ namespace __impl
 
     template <typename Parser>
     using ParsedResultType = typename ParsedMirType<Parser>::first_type;
+
+    // Streaming support: set whenever a parser's result depends on the input past its end, e.g. it failed on an empty
+    // input, or stopped at the end of a run which more input might extend. Only the cold end-of-input paths touch it.
+    inline thread_local bool end_of_input_hit = false;
+
+    constexpr void HitEndOfInput() noexcept
+    {
+        if (!std::is_constant_evaluated())
+        {
+            end_of_input_hit = true;
+        }
+    }
+
+    // Storage of a result which is not default-initializable, so it can still be passed as an out-parameter.
+    template <typename T>
+    class Deferred
+    {
+    public:
+        template <typename U>
+        constexpr Deferred& operator=(U&& value)
+        {
+            _value = std::forward<U>(value);
+            return *this;
+        }
+
+        constexpr T& get() noexcept
+        {
+            return *_value;
+        }
+
+    private:
+        std::optional<T> _value;
+    };
+
+    // The out-parameter type used to receive a `T` from a lowered parser.
+    template <typename T>
+    using Slot = std::conditional_t<std::default_initializable<T>, T, Deferred<T>>;
+
+    template <typename T>
+    constexpr T& Get(T& slot) noexcept
+    {
+        return slot;
+    }
+
+    template <typename T>
+    constexpr T& Get(Deferred<T>& slot) noexcept
+    {
+        return slot.get();
+    }
+
+    // The out-parameter of a recognizer, which drops whatever is assigned to it.
+    // Parsers run with it (see `Recognize`) only consume input: those which build their result from their inner
+    // parsers' results (`Map`, `Combine`, folds...) check `discards<Out>` to skip building them, and pass it down.
+    struct Discard
+    {
+        template <typename U>
+        constexpr Discard& operator=(U&&) noexcept
+        {
+            return *this;
+        }
+    };
+
+    template <typename Out>
+    concept discards = std::same_as<Out, Discard>;
+
+    // A parser lowered onto the out-parameter protocol:
+    //
+    //     bool parse(ParserInput& code, Out& out) const
+    //
+    // On success it assigns the result to `out`, advances `code` past the consumed input and returns true.
+    // On failure it returns false, leaves `code` untouched and `out` unspecified.
+    // Combinators talk to each other through it, so no `ParserOutput` is built, checked and destructured between them.
+    template <typename Parser, typename Out>
+    concept lowered_parser = requires(const Parser& parser, ParserInput& code, Out& out) {
+        {
+            parser.parse(code, out)
+        } -> std::same_as<bool>;
+    };
+
+    // Run any parser through the out-parameter protocol.
+    // Parsers which are not lowered (e.g. user-defined lambdas) are called as `ParserInput -> ParserOutput a`.
+    template <typename Parser, typename Out>
+    constexpr bool Run(const Parser& parser, ParserInput& code, Out& out)
+    {
+        if constexpr (lowered_parser<Parser, Out>)
+        {
+            return parser.parse(code, out);
+        }
+        else
+        {
+            auto mir = parser(code);
+            if (mir.is_none())
+            {
+                return false;
+            }
+            auto&& [value, rest] = std::move(mir).unwrap_unchecked();
+            out                  = std::move(value);
+            code                 = rest;
+            return true;
+        }
+    }
+
+    // The bytes a parser may start with when it succeeds.
+    // A `nullable` parser may also succeed without consuming anything, whatever (and even if no) byte comes next.
+    struct FirstSet
+    {
+        CharSet chars{};
+        bool    nullable{false};
+    };
+
+    // Parsers which know their `FirstSet`, through `constexpr FirstSet first() const`.
+    template <typename Parser>
+    concept first_set_aware = requires(const Parser& parser) {
+        {
+            parser.first()
+        } -> std::same_as<FirstSet>;
+    };
+
+    // Any other parser (e.g. user-defined lambdas) may start with anything.
+    template <typename Parser>
+    constexpr FirstSet FirstOf(const Parser& parser) noexcept
+    {
+        if constexpr (first_set_aware<Parser>)
+        {
+            return parser.first();
+        }
+        else
+        {
+            return {CharSet::all(), true};
+        }
+    }
+
+    // FIRST of `parser1` then `parser2`
+    constexpr FirstSet FirstOfSequence(const FirstSet& first1, const FirstSet& first2) noexcept
+    {
+        if (!first1.nullable)
+        {
+            return first1;
+        }
+        return {first1.chars | first2.chars, first2.nullable};
+    }
+
+    // FIRST of `parser1` or `parser2`
+    constexpr FirstSet FirstOfAlternative(const FirstSet& first1, const FirstSet& first2) noexcept
+    {
+        return {first1.chars | first2.chars, first1.nullable || first2.nullable};
+    }
+
+    // The base of every lowered parser, which provides the monadic entry point on top of `Derived::parse()`.
+    //
+    // operator() :: ParserInput -> ParserOutput a
+    template <typename Derived, typename T>
+    class ParserBase
+    {
+    public:
+        constexpr ParserOutput<T> operator()(ParserInput code) const
+        {
+            Slot<T> out{};
+            if (static_cast<const Derived&>(*this).parse(code, out))
+            {
+                return SOME(std::make_pair(std::move(Get(out)), code));
+            }
+            return NONE;
+        }
+    };
+
+    template <typename Parser, typename Fn>
+    class MapParser : public ParserBase<MapParser<Parser, Fn>, std::invoke_result_t<Fn, ParsedResultType<Parser>>>
+    {
+    public:
+        constexpr MapParser(const Parser& parser, const Fn& fn) : _parser(parser), _fn(fn) {}
+
+        template <typename Out>
+        constexpr bool parse(ParserInput& code, Out& out) const
+        {
+            if constexpr (discards<Out>)
+            {
+                return Run(_parser, code, out);
+            }
+            else
+            {
+                Slot<ParsedResultType<Parser>> value{};
+                if (!Run(_parser, code, value))
+                {
+                    return false;
+                }
+                out = _fn(std::move(Get(value)));
+                return true;
+            }
+        }
+
+        constexpr FirstSet first() const noexcept
+        {
+            return FirstOf(_parser);
+        }
+
+    private:
+        Parser _parser;
+        Fn     _fn;
+    };
+}  // namespace __impl
+
+namespace __impl
+{
+    // The erased entry point of a parser of `T`: one indirect call into the lowered protocol.
+    template <typename T>
+    using ErasedParse = bool (*)(const void*, ParserInput&, Slot<T>&);
+
+    template <typename Parser, typename T>
+    bool ErasedRun(const void* parser, ParserInput& code, Slot<T>& out)
+    {
+        return Run(*static_cast<const Parser*>(parser), code, out);
+    }
+
+    // An erased parser: its address and its entry point.
+    template <typename T>
+    struct Erased
+    {
+        const void*    parser{nullptr};
+        ErasedParse<T> parse{nullptr};
+
+        template <typename Out>
+        bool operator()(ParserInput& code, Out& out) const
+        {
+            if constexpr (std::same_as<Out, Slot<T>>)
+            {
+                return parse(parser, code, out);
+            }
+            else
+            {
+                Slot<T> value{};
+                if (!parse(parser, code, value))
+                {
+                    return false;
+                }
+                out = std::move(Get(value));
+                return true;
+            }
+        }
+    };
+
+    template <typename Parser, typename Self, typename T>
+    concept erasable_parser = !std::same_as<std::decay_t<Parser>, Self> &&
+                              std::same_as<ParsedResultType<std::decay_t<Parser>>, T>;
 }  // namespace __impl
 
+// A type-erased, owning parser of `T`, for recursive and runtime-selected grammars.
+// Parsers up to `InlineSize` bytes (which are nothrow movable) are stored in place, only larger ones are allocated.
+// A call is a single indirect call through the lowered protocol, so it costs no allocation and no `ParserOutput`.
+// Calling an empty `AnyParser` throws `std::bad_function_call`.
+template <typename T, std::size_t InlineSize = 8 * sizeof(void*)>
+class AnyParser : public __impl::ParserBase<AnyParser<T, InlineSize>, T>
+{
+    struct Ops
+    {
+        void (*copy)(const void* parser, AnyParser& to);
+        void (*move)(AnyParser& from, AnyParser& to) noexcept;
+        void (*destroy)(void* parser) noexcept;
+    };
+
+    template <typename Parser>
+    static constexpr bool fits_inline = sizeof(Parser) <= InlineSize &&
+                                        alignof(Parser) <= alignof(std::max_align_t) &&
+                                        std::is_nothrow_move_constructible_v<Parser>;
+
+public:
+    AnyParser() noexcept = default;
+
+    template <typename Parser>
+        requires __impl::erasable_parser<Parser, AnyParser, T>
+    AnyParser(Parser&& parser)
+    {
+        emplace<std::decay_t<Parser>>(std::forward<Parser>(parser));
+    }
+
+    AnyParser(const AnyParser& other)
+    {
+        if (other._ops != nullptr)
+        {
+            other._ops->copy(other.stored(), *this);
+        }
+    }
+
+    AnyParser(AnyParser&& other) noexcept
+    {
+        if (other._ops != nullptr)
+        {
+            other._ops->move(other, *this);
+        }
+    }
+
+    AnyParser& operator=(const AnyParser& other)
+    {
+        if (this != &other)
+        {
+            *this = AnyParser(other);
+        }
+        return *this;
+    }
+
+    AnyParser& operator=(AnyParser&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            if (other._ops != nullptr)
+            {
+                other._ops->move(other, *this);
+            }
+        }
+        return *this;
+    }
+
+    template <typename Parser>
+        requires __impl::erasable_parser<Parser, AnyParser, T>
+    AnyParser& operator=(Parser&& parser)
+    {
+        return *this = AnyParser(std::forward<Parser>(parser));
+    }
+
+    ~AnyParser()
+    {
+        reset();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return _ops != nullptr;
+    }
+
+    // whether the stored parser lives in place
+    bool is_inline() const noexcept
+    {
+        return _erased.parser == static_cast<const void*>(_buffer);
+    }
+
+    template <typename Out>
+    bool parse(ParserInput& code, Out& out) const
+    {
+        return _erased(code, out);
+    }
+
+    // The erased parser currently stored, which `ParserRef` calls directly.
+    // It stays at the same address for the lifetime of this `AnyParser`, and follows its assignments.
+    const __impl::Erased<T>& erased() const noexcept
+    {
+        return _erased;
+    }
+
+private:
+    static bool EmptyParse(const void*, ParserInput&, __impl::Slot<T>&)
+    {
+        throw std::bad_function_call();
+    }
+
+    template <typename Parser, typename... Args>
+    void emplace(Args&&... args)
+    {
+        if constexpr (fits_inline<Parser>)
+        {
+            _erased.parser = ::new (static_cast<void*>(_buffer)) Parser(std::forward<Args>(args)...);
+            _ops           = &INLINE_OPS<Parser>;
+        }
+        else
+        {
+            _erased.parser = new Parser(std::forward<Args>(args)...);
+            _ops           = &HEAP_OPS<Parser>;
+        }
+        _erased.parse = &__impl::ErasedRun<Parser, T>;
+    }
+
+    void* stored() const noexcept
+    {
+        return const_cast<void*>(_erased.parser);
+    }
+
+    void reset() noexcept
+    {
+        if (_ops != nullptr)
+        {
+            _ops->destroy(stored());
+        }
+        _erased = {nullptr, &EmptyParse};
+        _ops    = nullptr;
+    }
+
+    template <typename Parser>
+    static constexpr Ops INLINE_OPS{
+        [](const void* parser, AnyParser& to) { to.template emplace<Parser>(*static_cast<const Parser*>(parser)); },
+        [](AnyParser& from, AnyParser& to) noexcept {
+            to.template emplace<Parser>(std::move(*static_cast<Parser*>(from.stored())));
+            from.reset();
+        },
+        [](void* parser) noexcept { static_cast<Parser*>(parser)->~Parser(); },
+    };
+
+    template <typename Parser>
+    static constexpr Ops HEAP_OPS{
+        [](const void* parser, AnyParser& to) { to.template emplace<Parser>(*static_cast<const Parser*>(parser)); },
+        [](AnyParser& from, AnyParser& to) noexcept {
+            // steal the allocation
+            to._erased = std::exchange(from._erased, {nullptr, &EmptyParse});
+            to._ops    = std::exchange(from._ops, nullptr);
+        },
+        [](void* parser) noexcept { delete static_cast<Parser*>(parser); },
+    };
+
+    alignas(std::max_align_t) std::byte _buffer[InlineSize];
+    __impl::Erased<T>                  _erased{nullptr, &EmptyParse};
+    const Ops*                         _ops{nullptr};
+};
+
+// A non-owning reference to a parser of `T`, e.g. to refer to a grammar rule from inside its own definition.
+// The referred parser must outlive the reference, so never bind it to a temporary.
+// A reference to an `AnyParser` calls the parser stored in it directly, and sees it being reassigned.
+template <typename T>
+class ParserRef : public __impl::ParserBase<ParserRef<T>, T>
+{
+public:
+    template <typename Parser>
+        requires __impl::erasable_parser<Parser, ParserRef, T>
+    ParserRef(const Parser& parser) noexcept : _local{&parser, &__impl::ErasedRun<Parser, T>}, _target(&_local)
+    {
+    }
+
+    template <std::size_t InlineSize>
+    ParserRef(const AnyParser<T, InlineSize>& parser) noexcept : _target(&parser.erased())
+    {
+    }
+
+    ParserRef(const ParserRef& other) noexcept
+        : _local(other._local), _target(other._target == &other._local ? &_local : other._target)
+    {
+    }
+
+    ParserRef& operator=(const ParserRef& other) noexcept
+    {
+        _local  = other._local;
+        _target = other._target == &other._local ? &_local : other._target;
+        return *this;
+    }
+
+    template <typename Out>
+    bool parse(ParserInput& code, Out& out) const
+    {
+        return (*_target)(code, out);
+    }
+
+private:
+    __impl::Erased<T>        _local;
+    const __impl::Erased<T>* _target;
+};
+
 // `Parser a :: String -> [(a, String )]` is a Monad.
+// The type-erased form of it, for the grammars which can not be spelt as a single type.
 template <typename T>
-// using Parser = auto(*)(ParserInput) -> ParserOutput<T>;
-using Parser = std::function<ParserOutput<T>(ParserInput)>;
+using Parser = AnyParser<T>;
+
+// For user-defined parsers which may be streamed (see `StreamParser`): call it whenever the result depends on the
+// input past its end, so the stream waits for more input instead of taking the result as final.
+constexpr void NoteEndOfInput() noexcept
+{
+    __impl::HitEndOfInput();
+}
 
 // map a function into a `Parser a`
 // Fn b :: a -> b
@@ -43,13 +507,7 @@ using Parser = std::function<ParserOutput<T>(ParserInput)>;
 template <typename Parser, typename Fn>
 constexpr auto Map(Parser&& parser, Fn&& fn)
 {
-    using Mir = __impl::ParsedMirType<Parser>;
-    using T   = __impl::ParsedResultType<Parser>;
-    using R   = ParserOutput<std::invoke_result_t<Fn, T>>;
-
-    return [=](ParserInput code) -> R {
-        return parser(code) >>= [=](const Mir& mir) -> R { return SOME(std::make_pair(fn(mir.first), mir.second)); };
-    };
+    return __impl::MapParser<std::decay_t<Parser>, std::decay_t<Fn>>(parser, fn);
 }
 
 // bind a function into a `Parser a`
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "./parser.hpp"
+
+using d1::core::parser::ParserInput;
+
+namespace d1::core::stream
+{
+using namespace std::literals;
+
+constexpr auto MODULE_NAME{"core/stream.hpp"sv};
+
+enum class StreamStatus
+{
+    Ready,     // every complete item is parsed, the rest (if any) waits for more input
+    Error,     // an item does not parse, or parses to nothing
+    Overflow,  // an item is longer than the buffer
+};
+
+namespace __impl
+{
+    using d1::core::parser::__impl::end_of_input_hit;
+    using d1::core::parser::__impl::Get;
+    using d1::core::parser::__impl::ParsedResultType;
+    using d1::core::parser::__impl::Run;
+    using d1::core::parser::__impl::Slot;
+
+    // the least bytes taken from a chunk to retry an item split across chunks
+    constexpr std::size_t MIN_REFILL = 4096;
+}  // namespace __impl
+
+// Parse a stream of items (records, lines, statements...) from input which arrives in chunks, e.g. read from a socket
+// or a pipe, with a bounded buffer.
+//
+// Each item is parsed in place from the chunk it lies in. An item is only final when its parser did not look past
+// the end of the chunk (see `NoteEndOfInput()`); otherwise the stream keeps its bytes, at most `capacity`, and parses
+// it again from its start once the next chunk arrives. So the memory held between chunks is one partial item, not the
+// stream, and resuming needs no state from the parsers.
+//
+// The items are passed to the sink as they are parsed: views into the input are valid during the call only.
+template <typename Parser, typename T = __impl::ParsedResultType<Parser>>
+class StreamParser
+{
+public:
+    explicit StreamParser(Parser parser, std::size_t capacity = 1 << 20)
+        : _parser(std::move(parser)), _capacity(capacity)
+    {
+    }
+
+    // Parse the items of the next chunk, with the bytes pending from the previous ones.
+    // After an `Error` or an `Overflow`, nothing is parsed until `reset()`.
+    template <typename Sink>
+    StreamStatus feed(ParserInput chunk, Sink&& sink)
+    {
+        return run(chunk, false, sink);
+    }
+
+    // The end of the stream: parse what is pending as final, a partial item is an `Error`.
+    template <typename Sink>
+    StreamStatus finish(Sink&& sink)
+    {
+        return run({}, true, sink);
+    }
+
+    void reset()
+    {
+        _buffer.clear();
+        _status = StreamStatus::Ready;
+    }
+
+    // the bytes of the partial item kept for the next chunk
+    ParserInput pending() const noexcept
+    {
+        return _buffer;
+    }
+
+    // the bytes of the stream consumed by parsed items, the position of the failure after an `Error`
+    std::size_t consumed() const noexcept
+    {
+        return _consumed;
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+private:
+    template <typename Sink>
+    StreamStatus run(ParserInput chunk, bool eof, Sink& sink)
+    {
+        while (_status == StreamStatus::Ready)
+        {
+            if (_buffer.empty())
+            {
+                auto code = chunk;
+                if (drain(code, eof, sink) && !code.empty())
+                {
+                    if (code.size() > _capacity)
+                    {
+                        return _status = StreamStatus::Overflow;
+                    }
+                    _buffer.assign(code);
+                }
+                return _status;
+            }
+
+            // an item split across chunks: retry it with more of the chunk, doubling the retried bytes each time
+            const auto pending = _buffer.size();
+            const auto take    = std::min({chunk.size(), std::max(pending, __impl::MIN_REFILL), _capacity - pending});
+            _buffer.append(chunk.data(), take);
+
+            ParserInput code     = _buffer;
+            const auto  ready    = drain(code, eof && take == chunk.size(), sink);
+            const auto  consumed = _buffer.size() - code.size();
+            if (ready && consumed >= pending)
+            {
+                // the rest lies in the chunk, parse it in place
+                chunk.remove_prefix(consumed - pending);
+                _buffer.clear();
+                continue;
+            }
+            _buffer.erase(0, consumed);
+            chunk.remove_prefix(take);
+            if (ready && chunk.empty())
+            {
+                return _status;
+            }
+            if (ready && _buffer.size() >= _capacity)
+            {
+                _status = StreamStatus::Overflow;
+            }
+        }
+        return _status;
+    }
+
+    // Parse the final items at the head of `code`. Returns false on an error, else `code` is what waits for more input.
+    template <typename Sink>
+    bool drain(ParserInput& code, bool eof, Sink& sink)
+    {
+        while (!code.empty())
+        {
+            __impl::Slot<T> out{};
+            auto            rest = code;
+
+            __impl::end_of_input_hit = false;
+            const auto parsed        = __impl::Run(_parser, rest, out);
+            if (__impl::end_of_input_hit && !eof)
+            {
+                return true;
+            }
+            if (!parsed || rest.size() == code.size())
+            {
+                _status = StreamStatus::Error;
+                return false;
+            }
+            _consumed += code.size() - rest.size();
+            code = rest;
+            sink(std::move(__impl::Get(out)));
+        }
+        return true;
+    }
+
+    Parser       _parser;
+    std::string  _buffer;
+    std::size_t  _capacity;
+    std::size_t  _consumed{0};
+    StreamStatus _status{StreamStatus::Ready};
+};
+
+}  // namespace d1::core::stream
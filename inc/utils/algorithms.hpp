@@ -1,8 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <memory>
 #include <type_traits>
+#include <utility>
+
+#include "./iterator.hpp"
 
 namespace d1::utils::algorithm
 {
@@ -14,12 +23,84 @@ namespace __impl
 {
     template <typename Predicator, typename Iterator>
     concept iter_predicatable = std::predicate<Predicator, typename std::iterator_traits<Iterator>::value_type>;
+
+    // The runtime fast paths below work on the bytes of contiguous ranges, where they call into the C library (which
+    // is vectorized) or compare 8 bytes per step. Constant evaluation always takes the plain loops.
+
+    // a contiguous range of integers, where equal values are equal bytes
+    template <typename Iterator>
+    concept bytewise_comparable = std::contiguous_iterator<Iterator> && std::integral<std::iter_value_t<Iterator>>;
+
+    template <typename Iterator>
+    concept byte_sized = bytewise_comparable<Iterator> && sizeof(std::iter_value_t<Iterator>) == 1;
+
+    // a contiguous range which may be copied to another of the same type as bytes
+    template <typename InputIterator, typename OutputIterator>
+    concept bytewise_copyable = std::contiguous_iterator<InputIterator> && std::contiguous_iterator<OutputIterator> &&
+                                std::same_as<std::iter_value_t<InputIterator>, std::iter_value_t<OutputIterator>> &&
+                                std::is_trivially_copyable_v<std::iter_value_t<InputIterator>> &&
+                                std::is_assignable_v<std::iter_reference_t<OutputIterator>,
+                                                     std::iter_reference_t<InputIterator>>;
+
+    // The index of the first differing byte of `lhs` and `rhs`, or `size`.
+    inline std::size_t MismatchBytes(const unsigned char* lhs, const unsigned char* rhs, std::size_t size) noexcept
+    {
+        std::size_t pos = 0;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            // SWAR: the lowest set byte of the xor of two words is the first one which differs
+            for (; pos + 8 <= size; pos += 8)
+            {
+                std::uint64_t word1;
+                std::uint64_t word2;
+                std::memcpy(&word1, lhs + pos, 8);
+                std::memcpy(&word2, rhs + pos, 8);
+                if (const auto diff = word1 ^ word2; diff != 0)
+                {
+                    return pos + std::countr_zero(diff) / 8;
+                }
+            }
+        }
+        for (; pos != size && lhs[pos] == rhs[pos]; ++pos)
+        {
+        }
+        return pos;
+    }
+
+    // a `back_insert_iterator` into a container which appends ranges in bulk, e.g. `StaticVector`
+    template <typename OutputIterator, typename InputIterator>
+    concept bulk_back_inserter = d1::utils::iterator::is_back_insert_iterator<OutputIterator> &&
+                                 requires(OutputIterator dest, InputIterator first) {
+                                     dest.container().append(first, first);
+                                 };
+
+    template <typename Iterator>
+    const unsigned char* Bytes(Iterator it) noexcept
+    {
+        return reinterpret_cast<const unsigned char*>(std::to_address(it));
+    }
 }  // namespace __impl
 
 // The following functions should be constexpr in std...
 template <typename InputIterator, typename T>
 constexpr InputIterator find(InputIterator first, InputIterator last, const T& value)
 {
+    if constexpr (__impl::byte_sized<InputIterator> && std::integral<T>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            using value_t = std::iter_value_t<InputIterator>;
+
+            // no element equals a value out of its range
+            if (static_cast<T>(static_cast<value_t>(value)) != value || first == last)
+            {
+                return last;
+            }
+            const auto found = std::memchr(std::to_address(first), static_cast<unsigned char>(value), last - first);
+            return found == nullptr ? last : first + (static_cast<const unsigned char*>(found) - __impl::Bytes(first));
+        }
+    }
+
     for (; first != last; ++first)
     {
         if (*first == value)
@@ -88,6 +169,24 @@ template <typename InputIterator1, typename InputIterator2>
 constexpr std::pair<InputIterator1, InputIterator2> mismatch(InputIterator1 first1, InputIterator1 last1,
                                                              InputIterator2 first2, InputIterator2 last2)
 {
+    if constexpr (__impl::bytewise_comparable<InputIterator1> &&
+                  std::same_as<std::iter_value_t<InputIterator1>, std::iter_value_t<InputIterator2>> &&
+                  std::contiguous_iterator<InputIterator2>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            constexpr auto size = sizeof(std::iter_value_t<InputIterator1>);
+
+            const auto len = static_cast<std::size_t>(std::min(last1 - first1, last2 - first2));
+            if (len == 0)
+            {
+                return std::make_pair(first1, first2);
+            }
+            const auto pos = __impl::MismatchBytes(__impl::Bytes(first1), __impl::Bytes(first2), len * size) / size;
+            return std::make_pair(first1 + pos, first2 + pos);
+        }
+    }
+
     while (first1 != last1 && first2 != last2 && *first1 == *first2)
     {
         ++first1;
@@ -99,6 +198,19 @@ constexpr std::pair<InputIterator1, InputIterator2> mismatch(InputIterator1 firs
 template <typename InputIterator1, typename InputIterator2>
 constexpr bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
 {
+    if constexpr (__impl::bytewise_comparable<InputIterator1> &&
+                  std::same_as<std::iter_value_t<InputIterator1>, std::iter_value_t<InputIterator2>> &&
+                  std::contiguous_iterator<InputIterator2>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto len = last1 - first1;
+            return len == last2 - first2 &&
+                   (len == 0 || std::memcmp(std::to_address(first1), std::to_address(first2),
+                                            len * sizeof(std::iter_value_t<InputIterator1>)) == 0);
+        }
+    }
+
     while (first1 != last1 && first2 != last2 && *first1 == *first2)
     {
         ++first1;
@@ -115,9 +227,37 @@ constexpr auto distance(InputIterator first, InputIterator last)
     return static_cast<diff_t>(last - first);
 }
 
+namespace __impl
+{
+    // `memmove` `n` elements, so the ranges may overlap as `copy` and `move` allow
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator CopyBytes(InputIterator src_first, std::size_t n, OutputIterator dest) noexcept
+    {
+        if (n != 0)
+        {
+            std::memmove(std::to_address(dest), std::to_address(src_first), n * sizeof(std::iter_value_t<InputIterator>));
+        }
+        return dest + n;
+    }
+}  // namespace __impl
+
 template <typename InputIterator, typename OutputIterator>
 constexpr OutputIterator copy(InputIterator src_first, InputIterator src_last, OutputIterator dest)
 {
+    // one capacity check and one block copy instead of a `push_back()` per element
+    if constexpr (__impl::bulk_back_inserter<OutputIterator, InputIterator>)
+    {
+        dest.container().append(src_first, src_last);
+        return dest;
+    }
+    else if constexpr (__impl::bytewise_copyable<InputIterator, OutputIterator>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return __impl::CopyBytes(src_first, src_last - src_first, dest);
+        }
+    }
+
     for (; src_first != src_last; ++src_first)
     {
         *dest = *src_first;
@@ -145,6 +285,14 @@ constexpr OutputIterator copy_if(InputIterator src_first, InputIterator src_last
 template <typename InputIterator, typename OutputIterator>
 constexpr OutputIterator copy_n(InputIterator src_first, InputIterator src_last, OutputIterator dest, std::size_t n)
 {
+    if constexpr (__impl::bytewise_copyable<InputIterator, OutputIterator>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return __impl::CopyBytes(src_first, std::min(n, static_cast<std::size_t>(src_last - src_first)), dest);
+        }
+    }
+
     for (; n != 0 && src_first != src_last; ++src_first, --n)
     {
         *dest = *src_first;
@@ -167,6 +315,15 @@ constexpr BidirectionIterator2 copy_backward(BidirectionIterator1 src_first, Bid
 template <typename InputIterator, typename OutputIterator>
 constexpr OutputIterator move(InputIterator src_first, InputIterator src_last, OutputIterator dest)
 {
+    // moving a trivially copyable value copies it
+    if constexpr (__impl::bytewise_copyable<InputIterator, OutputIterator>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return __impl::CopyBytes(src_first, src_last - src_first, dest);
+        }
+    }
+
     for (; src_first != src_last; ++src_first)
     {
         *dest = std::move(*src_first);
@@ -194,6 +351,14 @@ constexpr OutputIterator move_if(InputIterator src_first, InputIterator src_last
 template <typename InputIterator, typename OutputIterator>
 constexpr OutputIterator move_n(InputIterator src_first, InputIterator src_last, OutputIterator dest, std::size_t n)
 {
+    if constexpr (__impl::bytewise_copyable<InputIterator, OutputIterator>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return __impl::CopyBytes(src_first, std::min(n, static_cast<std::size_t>(src_last - src_first)), dest);
+        }
+    }
+
     for (; n != 0 && src_first != src_last; ++src_first, --n)
     {
         *dest = std::move(*src_first);
@@ -217,6 +382,19 @@ template <typename InputIterator, typename T>
     requires std::convertible_to<T, typename std::iterator_traits<InputIterator>::value_type>
 constexpr void fill(InputIterator src_first, InputIterator src_last, T value)
 {
+    if constexpr (__impl::byte_sized<InputIterator>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            if (src_first != src_last)
+            {
+                const auto byte = static_cast<std::iter_value_t<InputIterator>>(value);
+                std::memset(std::to_address(src_first), static_cast<unsigned char>(byte), src_last - src_first);
+            }
+            return;
+        }
+    }
+
     for (; src_first != src_last; ++src_first)
     {
         *src_first = value;
@@ -227,6 +405,15 @@ template <typename InputIterator, typename T>
     requires std::convertible_to<T, typename std::iterator_traits<InputIterator>::value_type>
 constexpr void fill_n(InputIterator src_first, InputIterator src_last, T value, std::size_t n)
 {
+    if constexpr (__impl::byte_sized<InputIterator>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            fill(src_first, src_first + std::min(n, static_cast<std::size_t>(src_last - src_first)), value);
+            return;
+        }
+    }
+
     for (; n != 0 && src_first != src_last; ++src_first, --n)
     {
         *src_first = value;
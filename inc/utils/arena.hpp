@@ -0,0 +1,492 @@
+#pragma once
+
+#include "./algorithms.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace d1::utils::arena
+{
+using namespace std::literals;
+
+constexpr auto MODULE_NAME{"utils/arena.hpp"sv};
+
+// A bump allocator: an allocation moves a cursor through a block, and nothing is freed one by one.
+// `rewind()` frees everything allocated since a `mark()` at once by moving the cursor back, and the blocks are kept to
+// be reused, so the memory of a parse is released in O(1) and the next parse allocates nothing from the system.
+// Not thread-safe: use one arena per thread.
+class Arena
+{
+public:
+    // where the cursor is, to `rewind()` to
+    struct Mark
+    {
+        std::size_t block{0};
+        std::size_t used{0};
+    };
+
+    explicit Arena(std::size_t block_size = 4096) : _block_size(block_size) {}
+
+    Arena(const Arena&)            = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // `size` bytes aligned on `align` (a power of 2), valid until the arena is rewound past them
+    void* allocate(std::size_t size, std::size_t align = alignof(std::max_align_t))
+    {
+        if (!_blocks.empty())
+        {
+            const auto offset = aligned_offset(align);
+            if (offset + size <= _blocks[_block].size)
+            {
+                return bump(offset, size);
+            }
+        }
+        next_block(size + align);
+        return bump(aligned_offset(align), size);
+    }
+
+    // Grow the latest allocation `ptr` from `size` to `new_size` bytes in place, if its block has room left.
+    bool extend(void* ptr, std::size_t size, std::size_t new_size) noexcept
+    {
+        if (_blocks.empty() || ptr == nullptr)
+        {
+            return false;
+        }
+        const auto top   = _blocks[_block].data.get() + _used;
+        const auto first = static_cast<std::byte*>(ptr);
+        if (first < _blocks[_block].data.get() || first + size != top || _used - size + new_size > _blocks[_block].size)
+        {
+            return false;
+        }
+        _used = _used - size + new_size;
+        return true;
+    }
+
+    Mark mark() const noexcept
+    {
+        return {_block, _used};
+    }
+
+    // free everything allocated since `mark`
+    void rewind(Mark mark) noexcept
+    {
+        _block = mark.block;
+        _used  = mark.used;
+    }
+
+    // free everything
+    void reset() noexcept
+    {
+        rewind({});
+    }
+
+    // the bytes reserved from the system
+    std::size_t capacity() const noexcept
+    {
+        std::size_t bytes = 0;
+        for (const auto& block : _blocks)
+        {
+            bytes += block.size;
+        }
+        return bytes;
+    }
+
+private:
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t                  size;
+    };
+
+    // the offset of the first address past the cursor aligned on `align`: a block itself is only aligned on
+    // `max_align_t`, so the address is aligned, not the offset
+    std::size_t aligned_offset(std::size_t align) const noexcept
+    {
+        const auto base = reinterpret_cast<std::uintptr_t>(_blocks[_block].data.get());
+        return ((base + _used + align - 1) & ~(align - 1)) - base;
+    }
+
+    void* bump(std::size_t offset, std::size_t size) noexcept
+    {
+        _used = offset + size;
+        return _blocks[_block].data.get() + offset;
+    }
+
+    // move to a free block of at least `least` bytes, replacing the next one if it is too small
+    void next_block(std::size_t least)
+    {
+        const auto next = _blocks.empty() ? 0 : _block + 1;
+        if (next == _blocks.size() || _blocks[next].size < least)
+        {
+            auto size = _blocks.empty() ? _block_size : _blocks.back().size * 2;
+            for (; size < least; size *= 2)
+            {
+            }
+            auto block = Block{std::make_unique_for_overwrite<std::byte[]>(size), size};
+            if (next == _blocks.size())
+            {
+                _blocks.push_back(std::move(block));
+            }
+            else
+            {
+                _blocks[next] = std::move(block);
+            }
+        }
+        _block = next;
+        _used  = 0;
+    }
+
+    std::vector<Block> _blocks;
+    std::size_t        _block{0};
+    std::size_t        _used{0};
+    std::size_t        _block_size;
+};
+
+namespace __impl
+{
+    inline thread_local Arena* current_arena = nullptr;
+}  // namespace __impl
+
+// Make `arena` the one the `ArenaVector`s of this thread allocate from, for the lifetime of the scope, e.g. a parse.
+// Leaving the scope frees all their memory at once, so the accumulators built in it must not outlive it.
+// Scopes nest: the outer arena is restored on exit.
+class ArenaScope
+{
+public:
+    explicit ArenaScope(Arena& arena) noexcept
+        : _arena(arena), _mark(arena.mark()), _outer(std::exchange(__impl::current_arena, &arena))
+    {
+    }
+
+    ArenaScope(const ArenaScope&)            = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    ~ArenaScope()
+    {
+        _arena.rewind(_mark);
+        __impl::current_arena = _outer;
+    }
+
+private:
+    Arena&      _arena;
+    Arena::Mark _mark;
+    Arena*      _outer;
+};
+
+// The arena of the innermost `ArenaScope` of this thread.
+// Throws `std::logic_error` outside any scope.
+inline Arena& CurrentArena()
+{
+    if (__impl::current_arena == nullptr)
+    {
+        throw std::logic_error("no ArenaScope is active");
+    }
+    return *__impl::current_arena;
+}
+
+// A vector without a capacity limit, for the accumulators of folds at runtime (`Many`, `Any`, `While`...).
+// It allocates from the arena of the current `ArenaScope` when it first grows, and keeps to that arena. It grows in
+// place while it is the latest allocation of the arena (which an accumulator being filled usually is), and moves to a
+// twice larger buffer otherwise. Nothing is ever freed but by the arena.
+// Elements must be trivially copyable, since they are moved around by `memcpy` and never destroyed. Not constexpr:
+// use `StaticVector` in constant evaluation.
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+class ArenaVector
+{
+public:
+    using value_type      = T;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
+
+    ArenaVector() = default;
+
+    template <typename InputIterator>
+    ArenaVector(InputIterator first, const InputIterator& last)
+    {
+        for (; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    ArenaVector(std::initializer_list<T> init) : ArenaVector(init.begin(), init.end()) {}
+
+    // a copy owns a new buffer, from the current arena
+    ArenaVector(const ArenaVector& other)
+    {
+        append_copy(other);
+    }
+
+    ArenaVector(ArenaVector&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)),
+          _capacity(std::exchange(other._capacity, 0)), _arena(std::exchange(other._arena, nullptr))
+    {
+    }
+
+    ArenaVector& operator=(const ArenaVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            append_copy(other);
+        }
+        return *this;
+    }
+
+    ArenaVector& operator=(ArenaVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _data     = std::exchange(other._data, nullptr);
+            _size     = std::exchange(other._size, 0);
+            _capacity = std::exchange(other._capacity, 0);
+            _arena    = std::exchange(other._arena, nullptr);
+        }
+        return *this;
+    }
+
+    iterator begin() noexcept
+    {
+        return _data;
+    }
+    const_iterator begin() const noexcept
+    {
+        return _data;
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return _data;
+    }
+
+    iterator end() noexcept
+    {
+        return _data + _size;
+    }
+    const_iterator end() const noexcept
+    {
+        return _data + _size;
+    }
+    const_iterator cend() const noexcept
+    {
+        return _data + _size;
+    }
+
+    // no index check
+    const T& operator[](std::size_t i) const noexcept
+    {
+        return _data[i];
+    }
+    T& operator[](std::size_t i) noexcept
+    {
+        return _data[i];
+    }
+
+    const T& at(std::size_t i) const
+    {
+        if (i >= _size)
+        {
+            throw std::range_error("index out of range!");
+        }
+        return _data[i];
+    }
+
+    // SAFETY: before calling `back()`, please ensure `empty()` returns false.
+    const T& back() const noexcept
+    {
+        return _data[_size - 1];
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    // keeps the buffer
+    void clear() noexcept
+    {
+        _size = 0;
+    }
+
+    const T* data() const noexcept
+    {
+        return _data;
+    }
+    T* data() noexcept
+    {
+        return _data;
+    }
+
+    void push_back(const T& value)
+    {
+        if (_size == _capacity)
+        {
+            grow(_size + 1);
+        }
+        _data[_size++] = value;
+    }
+
+    // append `[first, last)` with a single capacity check, and a block copy when the source is contiguous
+    template <typename InputIterator>
+    void append(InputIterator first, InputIterator last)
+    {
+        if constexpr (std::forward_iterator<InputIterator>)
+        {
+            const auto n = static_cast<std::size_t>(std::distance(first, last));
+            reserve(_size + n);
+            if constexpr (std::contiguous_iterator<InputIterator> && std::same_as<std::iter_value_t<InputIterator>, T>)
+            {
+                calgo::copy(std::to_address(first), std::to_address(last), end());
+            }
+            else
+            {
+                std::copy(first, last, end());
+            }
+            _size += n;
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+        }
+    }
+
+    // Let `write` fill the spare capacity in place, like `StaticVector::append_with()`: it is called with
+    // `[end(), data() + capacity())` and returns the end of what it wrote, or `nullptr` if it does not fit, and then it
+    // is called again after the vector has grown.
+    template <typename Write>
+    void append_with(Write&& write)
+    {
+        for (;;)
+        {
+            const auto last = write(end(), _data + _capacity);
+            if (last != nullptr)
+            {
+                _size = static_cast<std::size_t>(last - _data);
+                return;
+            }
+            grow(_capacity + 1);
+        }
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > _capacity)
+        {
+            grow(capacity);
+        }
+    }
+
+private:
+    void append_copy(const ArenaVector& other)
+    {
+        if (!other.empty())
+        {
+            reserve(other._size);
+            std::memcpy(static_cast<void*>(_data), other._data, other._size * sizeof(T));
+            _size = other._size;
+        }
+    }
+
+    void grow(std::size_t least)
+    {
+        auto capacity = _capacity == 0 ? std::max<std::size_t>(64 / sizeof(T), 1) : _capacity * 2;
+        for (; capacity < least; capacity *= 2)
+        {
+        }
+
+        if (_arena == nullptr)
+        {
+            _arena = &CurrentArena();
+        }
+        else if (_arena->extend(_data, _capacity * sizeof(T), capacity * sizeof(T)))
+        {
+            _capacity = capacity;
+            return;
+        }
+
+        auto data = static_cast<T*>(_arena->allocate(capacity * sizeof(T), alignof(T)));
+        if (_size != 0)
+        {
+            std::memcpy(static_cast<void*>(data), _data, _size * sizeof(T));
+        }
+        _data     = data;
+        _capacity = capacity;
+    }
+
+    T*          _data{nullptr};
+    std::size_t _size{0};
+    std::size_t _capacity{0};
+    Arena*      _arena{nullptr};
+};
+
+template <typename T>
+bool operator==(const ArenaVector<T>& lhs, const ArenaVector<T>& rhs)
+{
+    return calgo::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+// The `ArenaVector` of chars: a string without a capacity limit, for the runtime counterparts of the `StaticString`
+// accumulators, e.g. `ParseArenaCString()`.
+template <typename Char = char>
+class ArenaString : public ArenaVector<Char>
+{
+public:
+    using ArenaVector<Char>::ArenaVector;
+
+    explicit ArenaString(std::basic_string_view<Char> str) : ArenaVector<Char>(str.begin(), str.end()) {}
+
+    std::basic_string_view<Char> to_string_view() const noexcept
+    {
+        return {this->data(), this->size()};
+    }
+
+    operator std::basic_string_view<Char>() const noexcept
+    {
+        return to_string_view();
+    }
+
+    using ArenaVector<Char>::append;
+
+    void append(std::basic_string_view<Char> str)
+    {
+        this->append(str.begin(), str.end());
+    }
+};
+
+template <typename Char>
+bool operator==(const ArenaString<Char>& lhs, std::type_identity_t<std::basic_string_view<Char>> rhs)
+{
+    return lhs.to_string_view() == rhs;
+}
+
+namespace operators
+{
+    using d1::utils::arena::operator==;
+}  // namespace operators
+
+}  // namespace d1::utils::arena
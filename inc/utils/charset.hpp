@@ -0,0 +1,265 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <immintrin.h>
+#    define D1_CHARSET_X86 1
+#endif
+
+namespace d1::utils::charset
+{
+using namespace std::literals;
+
+constexpr auto MODULE_NAME{"utils/charset.hpp"sv};
+
+// A 256-bit set of bytes.
+// Membership is a single shift-and-mask instead of a linear scan, and the whole set is constexpr-buildable.
+class CharSet
+{
+public:
+    constexpr CharSet() = default;
+
+    constexpr explicit CharSet(std::string_view chs) noexcept
+    {
+        for (const char ch : chs)
+        {
+            insert(ch);
+        }
+    }
+
+    // [first, last], both inclusive
+    static constexpr CharSet range(char first, char last) noexcept
+    {
+        CharSet set;
+        for (auto byte = static_cast<unsigned char>(first); byte <= static_cast<unsigned char>(last); ++byte)
+        {
+            set.insert(static_cast<char>(byte));
+            if (byte == 0xFF)
+            {
+                break;
+            }
+        }
+        return set;
+    }
+
+    // every byte
+    static constexpr CharSet all() noexcept
+    {
+        return ~CharSet();
+    }
+
+    constexpr void insert(char ch) noexcept
+    {
+        const auto byte = static_cast<unsigned char>(ch);
+        _bits[byte >> 6] |= std::uint64_t{1} << (byte & 63);
+    }
+
+    constexpr void erase(char ch) noexcept
+    {
+        const auto byte = static_cast<unsigned char>(ch);
+        _bits[byte >> 6] &= ~(std::uint64_t{1} << (byte & 63));
+    }
+
+    constexpr bool contains(char ch) const noexcept
+    {
+        const auto byte = static_cast<unsigned char>(ch);
+        return (_bits[byte >> 6] >> (byte & 63)) & 1;
+    }
+
+    constexpr std::size_t size() const noexcept
+    {
+        return std::popcount(_bits[0]) + std::popcount(_bits[1]) + std::popcount(_bits[2]) +
+               std::popcount(_bits[3]);
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return (_bits[0] | _bits[1] | _bits[2] | _bits[3]) == 0;
+    }
+
+    constexpr CharSet operator~() const noexcept
+    {
+        CharSet set;
+        for (std::size_t i = 0; i < _bits.size(); ++i)
+        {
+            set._bits[i] = ~_bits[i];
+        }
+        return set;
+    }
+
+    constexpr CharSet operator|(const CharSet& rhs) const noexcept
+    {
+        CharSet set;
+        for (std::size_t i = 0; i < _bits.size(); ++i)
+        {
+            set._bits[i] = _bits[i] | rhs._bits[i];
+        }
+        return set;
+    }
+
+    constexpr CharSet operator&(const CharSet& rhs) const noexcept
+    {
+        CharSet set;
+        for (std::size_t i = 0; i < _bits.size(); ++i)
+        {
+            set._bits[i] = _bits[i] & rhs._bits[i];
+        }
+        return set;
+    }
+
+    constexpr CharSet operator-(const CharSet& rhs) const noexcept
+    {
+        return *this & ~rhs;
+    }
+
+    constexpr bool operator==(const CharSet& rhs) const noexcept = default;
+
+private:
+    std::array<std::uint64_t, 4> _bits{};
+};
+
+namespace __impl
+{
+    // Nibble tables for the `pshufb` class match: bit `h` of `rows[lo]` is set iff byte `(h << 4) | lo` is in the
+    // set, with `low_rows` covering h in [0, 8) and `high_rows` covering h in [8, 16).
+    struct NibbleTables
+    {
+        alignas(16) std::array<std::uint8_t, 16> low_rows{};
+        alignas(16) std::array<std::uint8_t, 16> high_rows{};
+    };
+
+#if defined(D1_CHARSET_X86)
+    __attribute__((target("ssse3"))) inline const char* SpanSsse3(const NibbleTables& tables, const char* first,
+                                                                  const char* last) noexcept
+    {
+        const auto low_rows  = _mm_load_si128(reinterpret_cast<const __m128i*>(tables.low_rows.data()));
+        const auto high_rows = _mm_load_si128(reinterpret_cast<const __m128i*>(tables.high_rows.data()));
+        const auto bits      = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const auto low_mask  = _mm_set1_epi8(0x8F);
+        const auto high_flip = _mm_set1_epi8(static_cast<char>(0x80));
+        const auto nibble    = _mm_set1_epi8(0x0F);
+
+        for (; last - first >= 16; first += 16)
+        {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            // `pshufb` yields 0 for lanes whose index has the top bit set, which selects the table by the high nibble.
+            const auto index = _mm_and_si128(chunk, low_mask);
+            const auto row   = _mm_or_si128(_mm_shuffle_epi8(low_rows, index),
+                                            _mm_shuffle_epi8(high_rows, _mm_xor_si128(index, high_flip)));
+            const auto bit   = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble));
+            const auto hit   = _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit);
+            const auto miss  = ~static_cast<unsigned>(_mm_movemask_epi8(hit)) & 0xFFFF;
+
+            if (miss != 0)
+            {
+                return first + std::countr_zero(miss);
+            }
+        }
+        return first;
+    }
+
+    __attribute__((target("avx2"))) inline const char* SpanAvx2(const NibbleTables& tables, const char* first,
+                                                                const char* last) noexcept
+    {
+        const auto low_rows  = _mm256_broadcastsi128_si256(
+            _mm_load_si128(reinterpret_cast<const __m128i*>(tables.low_rows.data())));
+        const auto high_rows = _mm256_broadcastsi128_si256(
+            _mm_load_si128(reinterpret_cast<const __m128i*>(tables.high_rows.data())));
+        const auto bits      = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8,
+                                                16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const auto low_mask  = _mm256_set1_epi8(0x8F);
+        const auto high_flip = _mm256_set1_epi8(static_cast<char>(0x80));
+        const auto nibble    = _mm256_set1_epi8(0x0F);
+
+        for (; last - first >= 32; first += 32)
+        {
+            const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            const auto index = _mm256_and_si256(chunk, low_mask);
+            const auto row   = _mm256_or_si256(_mm256_shuffle_epi8(low_rows, index),
+                                               _mm256_shuffle_epi8(high_rows, _mm256_xor_si256(index, high_flip)));
+            const auto bit   = _mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(chunk, 4), nibble));
+            const auto hit   = _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+            const auto miss  = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(hit));
+
+            if (miss != 0)
+            {
+                return first + std::countr_zero(miss);
+            }
+        }
+        return SpanSsse3(tables, first, last);
+    }
+
+    enum class SimdLevel
+    {
+        Scalar,
+        Ssse3,
+        Avx2,
+    };
+
+    inline SimdLevel DetectSimdLevel() noexcept
+    {
+        static const auto level = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2")  ? SimdLevel::Avx2 :
+                   __builtin_cpu_supports("ssse3") ? SimdLevel::Ssse3 :
+                                                     SimdLevel::Scalar;
+        }();
+        return level;
+    }
+#endif
+}  // namespace __impl
+
+// A `CharSet` prepared for bulk scanning.
+// At runtime `span()` matches 16 or 32 bytes per step with SSSE3 / AVX2 (picked by cpuid), during constant evaluation
+// it falls back to a scalar loop.
+class CharSetScanner
+{
+public:
+    constexpr explicit CharSetScanner(const CharSet& set) noexcept : _set(set)
+    {
+        for (unsigned byte = 0; byte < 256; ++byte)
+        {
+            if (set.contains(static_cast<char>(byte)))
+            {
+                auto& rows = byte < 128 ? _tables.low_rows : _tables.high_rows;
+                rows[byte & 0x0F] |= static_cast<std::uint8_t>(1u << ((byte >> 4) & 7));
+            }
+        }
+    }
+
+    constexpr const CharSet& set() const noexcept
+    {
+        return _set;
+    }
+
+    // Returns the first position in [first, last) whose char is NOT in the set, or `last`.
+    constexpr const char* span(const char* first, const char* last) const noexcept
+    {
+#if defined(D1_CHARSET_X86)
+        if (!std::is_constant_evaluated())
+        {
+            switch (__impl::DetectSimdLevel())
+            {
+                case __impl::SimdLevel::Avx2: first = __impl::SpanAvx2(_tables, first, last); break;
+                case __impl::SimdLevel::Ssse3: first = __impl::SpanSsse3(_tables, first, last); break;
+                case __impl::SimdLevel::Scalar: break;
+            }
+        }
+#endif
+        for (; first != last && _set.contains(*first); ++first)
+        {
+        }
+        return first;
+    }
+
+private:
+    CharSet              _set;
+    __impl::NibbleTables _tables;
+};
+
+}  // namespace d1::utils::charset
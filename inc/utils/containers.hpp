@@ -5,10 +5,13 @@
 
 #include <array>
 #include <concepts>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 using d1::utils::iterator::back_insert_iterator;
@@ -28,19 +31,22 @@ namespace __impl
 }  // namespace __impl
 
 // a 'vector' with static memory alloc
+// The storage is left uninitialized at runtime: only the `size()` elements are ever constructed, copied or destroyed,
+// and `T` needs not be default-constructible. Under constant evaluation, the storage of a default-constructible `T` is
+// value-initialized first, so the vector may be the value of a constexpr variable.
 template <typename T, std::size_t Capacity = 16>
 class StaticVector
 {
 public:
     using value_type      = T;
-    using iterator        = typename std::array<T, Capacity>::iterator;
-    using const_iterator  = typename std::array<T, Capacity>::const_iterator;
-    using reference       = typename std::array<T, Capacity>::reference;
-    using const_reference = typename std::array<T, Capacity>::const_reference;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
 
     template <typename InputIterator>
         requires __impl::suitable_type<T, typename std::iterator_traits<InputIterator>::value_type>
-    constexpr StaticVector(InputIterator first, const InputIterator& last)
+    constexpr StaticVector(InputIterator first, const InputIterator& last) : StaticVector()
     {
         for (; first != last; ++first)
         {
@@ -54,70 +60,118 @@ public:
     {
     }
 
-    constexpr StaticVector() = default;
+    constexpr StaticVector()
+    {
+        if constexpr (std::default_initializable<T>)
+        {
+            if (std::is_constant_evaluated())
+            {
+                std::construct_at(&_storage.data);
+            }
+        }
+    }
+
+    constexpr StaticVector(const StaticVector& other) : StaticVector()
+    {
+        assign<false>(other);
+    }
+
+    constexpr StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : StaticVector()
+    {
+        assign<true>(other);
+    }
+
+    constexpr StaticVector& operator=(const StaticVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            assign<false>(other);
+        }
+        return *this;
+    }
+
+    constexpr StaticVector& operator=(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            assign<true>(other);
+        }
+        return *this;
+    }
+
+    constexpr ~StaticVector()
+        requires std::is_trivially_destructible_v<T>
+    = default;
+
+    constexpr ~StaticVector()
+    {
+        clear();
+    }
 
     constexpr auto begin() const
     {
-        return _data.begin();
+        return data();
     }
     constexpr auto begin()
     {
-        return _data.begin();
+        return data();
     }
     constexpr auto cbegin() const
     {
-        return _data.cbegin();
+        return data();
     }
 
     constexpr auto end() const
     {
-        return std::next(_data.begin(), _size);
+        return data() + _size;
     }
     constexpr auto end()
     {
-        return std::next(_data.begin(), _size);
+        return data() + _size;
     }
     constexpr auto cend() const
     {
-        return std::next(_data.cbegin(), _size);
+        return data() + _size;
     }
 
     constexpr auto rbegin() const
     {
-        return _data.rbegin();
+        return std::make_reverse_iterator(end());
     }
     constexpr auto rbegin()
     {
-        return _data.rbegin();
+        return std::make_reverse_iterator(end());
     }
-    constexpr auto crbegin()
+    constexpr auto crbegin() const
     {
-        return _data.crbegin();
+        return std::make_reverse_iterator(cend());
     }
 
     constexpr auto rend() const
     {
-        return _data.rend();
+        return std::make_reverse_iterator(begin());
     }
     constexpr auto rend()
     {
-        return _data.rend();
+        return std::make_reverse_iterator(begin());
     }
-    constexpr auto crend()
+    constexpr auto crend() const
     {
-        return _data.crend();
+        return std::make_reverse_iterator(cbegin());
     }
 
     // like std::vector, operator[] has no index check.
-    // if size <= i < capacity, T{} will be returned.
+    // if size <= i < capacity, T{} will be returned under constant evaluation, and garbage at runtime.
     // else, compile failed.
     constexpr const T& operator[](const std::size_t i) const noexcept
     {
-        return _data[i];
+        return _storage.data[i];
     }
     constexpr const T& operator[](const std::size_t i) noexcept
     {
-        return _data[i];
+        return _storage.data[i];
     }
 
     // but .at() has.
@@ -129,7 +183,7 @@ public:
         }
         else
         {
-            return _data[i];
+            return _storage.data[i];
         }
     }
     constexpr const T& at(const std::size_t i)
@@ -140,18 +194,18 @@ public:
         }
         else
         {
-            return _data[i];
+            return _storage.data[i];
         }
     }
 
     // SAFETY: before calling `back()`, please ensure `empty()` returns false.
     constexpr const T& back() const
     {
-        return _data[_size - 1];
+        return _storage.data[_size - 1];
     }
     constexpr const T& back()
     {
-        return _data[_size - 1];
+        return _storage.data[_size - 1];
     }
 
     constexpr auto capacity() const
@@ -171,12 +225,20 @@ public:
 
     constexpr void clear()
     {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            std::destroy(begin(), end());
+        }
         _size = 0;
     }
 
     constexpr const T* data() const
     {
-        return _data.data();
+        return _storage.data;
+    }
+    constexpr T* data()
+    {
+        return _storage.data;
     }
 
     template <typename U>
@@ -189,13 +251,120 @@ public:
         }
         else
         {
-            _data[_size++] = std::move(value);
+            std::construct_at(&_storage.data[_size], std::move(value));
+            ++_size;
+        }
+    }
+
+    // Append `[first, last)` with a single capacity check, and a block copy at runtime when the source is contiguous.
+    // All or nothing: throws `std::range_error` and appends nothing if the elements do not fit.
+    template <typename InputIterator>
+        requires __impl::suitable_type<T, typename std::iterator_traits<InputIterator>::value_type>
+    constexpr void append(InputIterator first, InputIterator last)
+    {
+        if constexpr (std::forward_iterator<InputIterator>)
+        {
+            if (static_cast<std::size_t>(std::distance(first, last)) > Capacity - _size)
+            {
+                __impl::oor_handle();
+            }
+            construct_back<false>(first, last);
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+        }
+    }
+
+    // Let `write` fill the spare capacity in place, for a writer which finds out how much it writes as it goes, e.g. a
+    // number rendered straight into a string. It is called with `[end(), data() + Capacity)` and returns the end of
+    // what it wrote, or `nullptr` if it does not fit: then `std::range_error` is thrown.
+    template <typename Write>
+        requires std::is_trivial_v<T>
+    constexpr void append_with(Write&& write)
+    {
+        const auto last = write(end(), data() + Capacity);
+        if (last == nullptr)
+        {
+            __impl::oor_handle();
+        }
+        else
+        {
+            _size = static_cast<std::size_t>(last - data());
         }
     }
 
 private:
-    std::array<T, Capacity> _data{};
-    std::size_t             _size{0};
+    // Copy (or move) the elements of `other` into this empty vector.
+    // A storage which fits a cache line is copied whole at runtime: a fixed-size copy beats a call to `memmove`.
+    template <bool Move, typename Vector>
+    constexpr void assign(Vector& other)
+    {
+        if constexpr (std::is_trivially_copyable_v<T> && sizeof(Storage) <= 64)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // the bytes past `size()` are garbage on purpose
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+                std::memcpy(static_cast<void*>(&_storage), &other._storage, sizeof(Storage));
+#pragma GCC diagnostic pop
+                _size = other._size;
+                return;
+            }
+        }
+        construct_back<Move>(other.begin(), other.end());
+    }
+
+    // Copy (or move) the elements of `[first, last)`, which fit, past the end.
+    // Contiguous trivially copyable elements are copied as a block (`calgo::copy`) at runtime.
+    template <bool Move, typename Iterator>
+    constexpr void construct_back(Iterator first, Iterator last)
+    {
+        if constexpr (std::is_trivially_copyable_v<T> && std::contiguous_iterator<Iterator> &&
+                      std::same_as<std::iter_value_t<Iterator>, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                calgo::copy(std::to_address(first), std::to_address(last), end());
+                _size += last - first;
+                return;
+            }
+        }
+        for (; first != last; ++first)
+        {
+            if constexpr (Move)
+            {
+                std::construct_at(&_storage.data[_size], std::move(*first));
+            }
+            else
+            {
+                std::construct_at(&_storage.data[_size], *first);
+            }
+            ++_size;
+        }
+    }
+
+    // Raw storage of `Capacity` elements: a union member is not initialized unless asked to.
+    union Storage
+    {
+        constexpr Storage() noexcept {}
+
+        constexpr ~Storage()
+            requires std::is_trivially_destructible_v<T>
+        = default;
+
+        // the elements are destroyed by the vector
+        constexpr ~Storage() {}
+
+        T data[Capacity];
+    };
+
+    Storage     _storage;
+    std::size_t _size{0};
 };
 
 template <typename T, std::size_t Cap1, std::size_t Cap2>
@@ -293,9 +462,11 @@ public:
         return *this = StaticString(str);
     }
 
-    constexpr const char* c_str() const noexcept
+    using StaticVector<Char, Capacity>::append;
+
+    constexpr void append(std::basic_string_view<Char> str)
     {
-        return this->data();
+        this->append(str.begin(), str.end());
     }
 
     constexpr std::string_view to_string_view() const noexcept
@@ -0,0 +1,892 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace d1::utils::decimal
+{
+using namespace std::literals;
+
+constexpr auto MODULE_NAME{"utils/decimal.hpp"sv};
+
+namespace __impl
+{
+    // SWAR: 8 chars per `std::uint64_t`, the first char in the lowest byte.
+    constexpr bool SWAR = std::endian::native == std::endian::little;
+
+    constexpr std::uint64_t BYTES_01 = 0x0101010101010101;
+    constexpr std::uint64_t BYTES_30 = 0x30 * BYTES_01;
+
+    // Load up to 8 chars of [first, last), the missing ones are '\0'.
+    inline std::uint64_t Load8(const char* first, const char* last) noexcept
+    {
+        std::uint64_t chunk = 0;
+        if (last - first >= 8)
+        {
+            std::memcpy(&chunk, first, 8);
+        }
+        else
+        {
+            std::memcpy(&chunk, first, static_cast<std::size_t>(last - first));
+        }
+        return chunk;
+    }
+
+    // the number of leading decimal digits in the chunk
+    constexpr std::size_t CountDigits8(std::uint64_t chunk) noexcept
+    {
+        // a byte is nonzero iff it is not in ['0', '9']: its high nibble is not 3, or its low nibble + 6 carries
+        const auto other = ((chunk & (0xF0 * BYTES_01)) ^ BYTES_30) | (((chunk & (0x0F * BYTES_01)) + 0x06 * BYTES_01) &
+                                                                      (0xF0 * BYTES_01));
+        const auto flags = (other | ((other & (0x7F * BYTES_01)) + 0x7F * BYTES_01)) & (0x80 * BYTES_01);
+        return static_cast<std::size_t>(std::countr_zero(flags)) / 8;
+    }
+
+    // The value of the first `count` (in [1, 8]) chars of the chunk, which must all be digits.
+    constexpr std::uint32_t ParseDigits8(std::uint64_t chunk, std::size_t count) noexcept
+    {
+        // move the digits to the high bytes, behind '0's
+        const auto pad = 8 * (8 - count);
+        chunk          = (chunk << pad) | (BYTES_30 & ((std::uint64_t{1} << pad) - 1));
+
+        chunk -= BYTES_30;
+        chunk = chunk * 10 + (chunk >> 8);
+        chunk = (((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+                 (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+                32;
+        return static_cast<std::uint32_t>(chunk);
+    }
+
+    constexpr std::uint64_t POW10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+}  // namespace __impl
+
+// Up to 7 digits at the head of [first, last) in a single step, the common case of a short number.
+// Returns the number of digits and stores their value, or returns 0 if there is none or if it may take more steps.
+inline std::size_t ParseShortDigits(const char* first, const char* last, std::uint32_t& value) noexcept
+{
+    if constexpr (__impl::SWAR)
+    {
+        const auto chunk = __impl::Load8(first, last);
+        const auto count = __impl::CountDigits8(chunk);
+        if (count != 0 && count < 8)
+        {
+            value = __impl::ParseDigits8(chunk, count);
+            return count;
+        }
+    }
+    return 0;
+}
+
+constexpr bool is_digit(char ch) noexcept
+{
+    return static_cast<unsigned char>(ch - '0') < 10;
+}
+
+// The number of leading decimal digits of [first, last), counting at most `limit`.
+// At runtime 8 chars are checked per step.
+constexpr std::size_t DigitSpan(const char* first, const char* last,
+                                std::size_t limit = static_cast<std::size_t>(-1)) noexcept
+{
+    std::size_t count = 0;
+    if constexpr (__impl::SWAR)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            for (; first != last && count < limit; first += 8)
+            {
+                const auto digits = __impl::CountDigits8(__impl::Load8(first, last));
+                count += digits;
+                if (digits < 8 || last - first <= 8)
+                {
+                    break;
+                }
+            }
+            return count < limit ? count : limit;
+        }
+    }
+    for (; first != last && count < limit && is_digit(*first); ++first)
+    {
+        ++count;
+    }
+    return count;
+}
+
+// The value of the `count` decimal digits at `first`, which must all be digits and fit in `U`.
+// At runtime 8 digits are converted per step, reading no further than `last`.
+template <typename U>
+constexpr U ParseDigits(const char* first, std::size_t count, const char* last) noexcept
+{
+    U value = 0;
+    if constexpr (__impl::SWAR)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            for (; count != 0;)
+            {
+                const auto step   = count < 8 ? count : 8;
+                const auto digits = __impl::ParseDigits8(__impl::Load8(first, last), step);
+                value             = static_cast<U>(value * __impl::POW10[step] + digits);
+                first += step;
+                count -= step;
+            }
+            return value;
+        }
+    }
+    for (; count != 0; --count, ++first)
+    {
+        value = static_cast<U>(value * 10 + (*first - '0'));
+    }
+    return value;
+}
+
+namespace __impl
+{
+    constexpr std::uint64_t POW10_64[] = {1,
+                                          10,
+                                          100,
+                                          1000,
+                                          10000,
+                                          100000,
+                                          1000000,
+                                          10000000,
+                                          100000000,
+                                          1000000000,
+                                          10000000000,
+                                          100000000000,
+                                          1000000000000,
+                                          10000000000000,
+                                          100000000000000,
+                                          1000000000000000,
+                                          10000000000000000,
+                                          100000000000000000,
+                                          1000000000000000000,
+                                          10000000000000000000u};
+
+    // "00" "01" ... "99": the digits are written two at a time
+    constexpr auto DIGIT_PAIRS = []() {
+        std::array<char, 200> pairs{};
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            pairs[2 * i]     = static_cast<char>('0' + i / 10);
+            pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+        }
+        return pairs;
+    }();
+}  // namespace __impl
+
+// The number of decimal digits of `n`, without a loop: log10 is estimated from the bit width, then corrected by a
+// single compare. (`n | 1` has as many digits as `n`, and at least one.)
+constexpr std::size_t CountDigits(std::uint64_t n) noexcept
+{
+    n |= 1;
+    const auto estimate = static_cast<std::size_t>(std::bit_width(n) * 1233) >> 12;
+    return estimate + 1 - (n < __impl::POW10_64[estimate]);
+}
+
+// Write the `count` low decimal digits of `n` at `first`, zero-padded, two at a time from the last one.
+constexpr void WriteDigits(char* first, std::uint64_t n, std::size_t count) noexcept
+{
+    auto last = first + count;
+    for (; count >= 2; count -= 2)
+    {
+        const auto pair = static_cast<std::size_t>(n % 100) * 2;
+        n /= 100;
+        *--last = __impl::DIGIT_PAIRS[pair + 1];
+        *--last = __impl::DIGIT_PAIRS[pair];
+    }
+    if (count != 0)
+    {
+        *--last = static_cast<char>('0' + n % 10);
+    }
+}
+
+// The number of digits of `n` in `base`: 2, 8, 10 or 16.
+constexpr std::size_t CountDigits(std::uint64_t n, unsigned base) noexcept
+{
+    if (base == 10)
+    {
+        return CountDigits(n);
+    }
+    const auto shift = static_cast<std::size_t>(std::countr_zero(base));
+    return (static_cast<std::size_t>(std::bit_width(n | 1)) + shift - 1) / shift;
+}
+
+// Write the `count` low digits of `n` in `base` (2, 8, 10 or 16) at `first`, zero-padded, in upper case if `upper`.
+constexpr void WriteDigits(char* first, std::uint64_t n, std::size_t count, unsigned base, bool upper = false) noexcept
+{
+    if (base == 10)
+    {
+        WriteDigits(first, n, count);
+        return;
+    }
+    const auto digits = upper ? "0123456789ABCDEF"sv : "0123456789abcdef"sv;
+    const auto shift  = std::countr_zero(base);
+    for (auto last = first + count; last != first; n >>= shift)
+    {
+        *--last = digits[n & (base - 1)];
+    }
+}
+
+// Render `value` in decimal at `first`, writing nothing past `last`.
+// Returns the end of the chars written, or `nullptr` (and writes nothing) if they do not fit.
+template <std::integral T>
+    requires(!std::same_as<T, bool> && sizeof(T) <= sizeof(std::uint64_t))
+constexpr char* FormatInteger(char* first, char* last, T value) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+
+    bool negative  = false;
+    auto magnitude = static_cast<std::uint64_t>(static_cast<U>(value));
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (value < 0)
+        {
+            negative  = true;
+            magnitude = static_cast<std::uint64_t>(static_cast<U>(U{0} - static_cast<U>(value)));
+        }
+    }
+    const auto count = CountDigits(magnitude);
+    if (static_cast<std::size_t>(last - first) < count + negative)
+    {
+        return nullptr;
+    }
+    if (negative)
+    {
+        *first++ = '-';
+    }
+    WriteDigits(first, magnitude, count);
+    return first + count;
+}
+
+namespace __impl
+{
+    // An unsigned integer of up to 1536 bits, for the exact arithmetic of `ShortestDecimal()` and `ScaledRound()`: the
+    // scaled values of a `double` take up to ~1350 bits.
+    class BigInt
+    {
+    public:
+        constexpr explicit BigInt(std::uint64_t value = 0) noexcept
+        {
+            _words[0] = static_cast<std::uint32_t>(value);
+            _words[1] = static_cast<std::uint32_t>(value >> 32);
+            _size     = _words[1] != 0 ? 2 : _words[0] != 0 ? 1 : 0;
+        }
+
+        constexpr BigInt& operator*=(std::uint32_t factor) noexcept
+        {
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < _size; ++i)
+            {
+                carry += std::uint64_t{_words[i]} * factor;
+                _words[i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+            if (carry != 0)
+            {
+                _words[_size++] = static_cast<std::uint32_t>(carry);
+            }
+            return *this;
+        }
+
+        constexpr BigInt& operator+=(const BigInt& rhs) noexcept
+        {
+            std::uint64_t carry = 0;
+            const auto    size  = _size > rhs._size ? _size : rhs._size;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                carry += std::uint64_t{_words[i]} + rhs._words[i];
+                _words[i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+            _size = size;
+            if (carry != 0)
+            {
+                _words[_size++] = static_cast<std::uint32_t>(carry);
+            }
+            return *this;
+        }
+
+        // SAFETY: `rhs` must not be greater than `*this`.
+        constexpr BigInt& operator-=(const BigInt& rhs) noexcept
+        {
+            std::uint64_t borrow = 0;
+            for (std::size_t i = 0; i < _size; ++i)
+            {
+                const auto diff = std::uint64_t{_words[i]} - rhs._words[i] - borrow;
+                _words[i]       = static_cast<std::uint32_t>(diff);
+                borrow          = diff >> 63;
+            }
+            for (; _size != 0 && _words[_size - 1] == 0; --_size)
+            {
+            }
+            return *this;
+        }
+
+        constexpr BigInt& operator<<=(std::size_t bits) noexcept
+        {
+            for (; bits >= 31; bits -= 31)
+            {
+                *this *= 1u << 31;
+            }
+            return *this *= 1u << bits;
+        }
+
+        constexpr BigInt& mul_pow10(std::size_t exponent) noexcept
+        {
+            for (; exponent >= 9; exponent -= 9)
+            {
+                *this *= 1000000000;
+            }
+            return *this *= static_cast<std::uint32_t>(POW10_64[exponent]);
+        }
+
+        // `*this /= divisor`, returning the remainder
+        constexpr std::uint32_t divide(std::uint32_t divisor) noexcept
+        {
+            std::uint64_t remainder = 0;
+            for (auto i = _size; i-- != 0;)
+            {
+                const auto current = (remainder << 32) | _words[i];
+                _words[i]          = static_cast<std::uint32_t>(current / divisor);
+                remainder          = current % divisor;
+            }
+            for (; _size != 0 && _words[_size - 1] == 0; --_size)
+            {
+            }
+            return static_cast<std::uint32_t>(remainder);
+        }
+
+        // `*this / divisor`, which must be less than 10, leaving the remainder in `*this`
+        constexpr std::uint32_t divmod(const BigInt& divisor) noexcept
+        {
+            std::uint32_t quotient = 0;
+            for (; Compare(*this, divisor) >= 0; ++quotient)
+            {
+                *this -= divisor;
+            }
+            return quotient;
+        }
+
+        constexpr bool is_zero() const noexcept
+        {
+            return _size == 0;
+        }
+
+        constexpr bool is_odd() const noexcept
+        {
+            return (_words[0] & 1) != 0;
+        }
+
+        friend constexpr int Compare(const BigInt& lhs, const BigInt& rhs) noexcept
+        {
+            if (lhs._size != rhs._size)
+            {
+                return lhs._size < rhs._size ? -1 : 1;
+            }
+            for (auto i = lhs._size; i-- != 0;)
+            {
+                if (lhs._words[i] != rhs._words[i])
+                {
+                    return lhs._words[i] < rhs._words[i] ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+    private:
+        std::uint32_t _words[48]{};
+        std::size_t   _size{0};
+    };
+
+    // `0.d1d2...dn * 10^exponent`, with `digits` = d1d2...dn, which reads back as `mantissa * 2^binary_exponent`
+    struct Decimal
+    {
+        std::uint64_t digits{0};
+        std::size_t   count{0};
+        int           exponent{0};
+        std::uint64_t mantissa{0};
+        int           binary_exponent{0};
+    };
+
+    template <typename T>
+    concept binary_float = std::floating_point<T> && std::numeric_limits<T>::is_iec559 &&
+                           (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t));
+
+    // `mantissa * 2^exponent`
+    struct Binary
+    {
+        std::uint64_t mantissa{0};
+        int           exponent{0};
+    };
+
+    template <binary_float T>
+    constexpr int MIN_BINARY_EXPONENT = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+
+    // the exact value of `value` (finite and positive), its hidden bit restored
+    template <binary_float T>
+    constexpr Binary Decompose(T value) noexcept
+    {
+        using Bits                   = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        constexpr int  MANTISSA_BITS = std::numeric_limits<T>::digits - 1;
+        constexpr Bits HIDDEN        = Bits{1} << MANTISSA_BITS;
+
+        const auto bits     = std::bit_cast<Bits>(value);
+        const auto biased   = static_cast<int>(bits >> MANTISSA_BITS);
+        const auto fraction = static_cast<std::uint64_t>(bits & (HIDDEN - 1));
+        return {biased == 0 ? fraction : fraction | HIDDEN, (biased == 0 ? 1 : biased) - 1 + MIN_BINARY_EXPONENT<T>};
+    }
+
+    // The shortest decimal which reads back as `value` (finite and positive), the closest one to `value` if several are
+    // as short, as `std::to_chars` (Ryu) finds it. This is the free-format algorithm of Burger & Dybvig, exact with
+    // `BigInt`s: slow, but constexpr.
+    template <binary_float T>
+    constexpr Decimal ShortestDecimal(T value) noexcept
+    {
+        constexpr auto HIDDEN = std::uint64_t{1} << (std::numeric_limits<T>::digits - 1);
+
+        const auto [mantissa, exponent] = Decompose(value);
+
+        // value = r / s, and the halfway points to the neighbours are (r - m_minus) / s and (r + m_plus) / s, all
+        // doubled; the gap below a power of 2 is half the gap above
+        const bool lower_gap = mantissa == HIDDEN && exponent > MIN_BINARY_EXPONENT<T>;
+        BigInt     r(mantissa), s(1), m_plus(1), m_minus(1);
+        r <<= lower_gap ? 2 : 1;
+        s <<= lower_gap ? 2 : 1;
+        if (lower_gap)
+        {
+            m_plus <<= 1;
+        }
+        if (exponent >= 0)
+        {
+            r <<= static_cast<std::size_t>(exponent);
+            m_plus <<= static_cast<std::size_t>(exponent);
+            m_minus <<= static_cast<std::size_t>(exponent);
+        }
+        else
+        {
+            s <<= static_cast<std::size_t>(-exponent);
+        }
+
+        // the neighbours halfway are read as `value` when its mantissa is even (ties to even)
+        const bool inclusive = mantissa % 2 == 0;
+        const auto too_low   = [&](const BigInt& rem) {
+            auto high = rem;
+            high += m_plus;
+            const auto cmp = Compare(high, s);
+            return inclusive ? cmp >= 0 : cmp > 0;
+        };
+
+        // scale to `0.1 <= (r + m_plus) / s < 1` (`<= 1` if inclusive), from an estimate of log10 which is never
+        // too high
+        const auto log2 = exponent + static_cast<int>(std::bit_width(mantissa)) - 1;
+        auto       k    = ((log2 * 1233) >> 12) - 1;
+        if (k >= 0)
+        {
+            s.mul_pow10(static_cast<std::size_t>(k));
+        }
+        else
+        {
+            r.mul_pow10(static_cast<std::size_t>(-k));
+            m_plus.mul_pow10(static_cast<std::size_t>(-k));
+            m_minus.mul_pow10(static_cast<std::size_t>(-k));
+        }
+        for (; too_low(r); ++k)
+        {
+            s *= 10;
+        }
+
+        Decimal result{0, 0, k, mantissa, exponent};
+        for (;;)
+        {
+            r *= 10;
+            m_plus *= 10;
+            m_minus *= 10;
+            auto       digit = r.divmod(s);
+            const auto cmp   = Compare(r, m_minus);
+            const bool low   = inclusive ? cmp <= 0 : cmp < 0;
+            const bool high  = too_low(r);
+            if (low || high)
+            {
+                // the last digit: round to the closer of `digit` and `digit + 1`, to even on a tie
+                auto twice = r;
+                twice *= 2;
+                const auto half = Compare(twice, s);
+                if (high && (!low || half > 0 || (half == 0 && digit % 2 == 1)))
+                {
+                    ++digit;
+                }
+                result.digits = result.digits * 10 + digit;
+                ++result.count;
+                return result;
+            }
+            result.digits = result.digits * 10 + digit;
+            ++result.count;
+        }
+    }
+
+    // Lay `decimal` out like `std::to_chars(first, last, value)`: the shorter of the fixed and the scientific
+    // notations, the fixed one on a tie. An integer in the fixed notation is written in full, as `printf("%.0f")` does:
+    // its exact digits, rather than the shortest ones padded with '0's.
+    constexpr char* WriteDecimal(char* first, char* last, bool negative, const Decimal& decimal) noexcept
+    {
+        const auto n          = decimal.count;
+        const auto k          = decimal.exponent;
+        const auto scientific = decimal.exponent - 1;
+        const auto magnitude  = static_cast<std::uint64_t>(scientific < 0 ? -scientific : scientific);
+        const auto exp_digits = magnitude >= 100 ? std::size_t{3} : std::size_t{2};
+
+        const auto sci_size   = n + (n > 1) + 2 + exp_digits;
+        const auto fixed_size = k <= 0                             ? 2 + static_cast<std::size_t>(-k) + n
+                                : static_cast<std::size_t>(k) < n ? n + 1
+                                                                   : static_cast<std::size_t>(k);
+        const auto size       = (fixed_size <= sci_size ? fixed_size : sci_size) + negative;
+        if (static_cast<std::size_t>(last - first) < size)
+        {
+            return nullptr;
+        }
+
+        if (negative)
+        {
+            *first++ = '-';
+        }
+        if (fixed_size > sci_size)
+        {
+            const auto tail = n - 1;
+            WriteDigits(first++, decimal.digits / POW10_64[tail], 1);
+            if (tail != 0)
+            {
+                *first++ = '.';
+                WriteDigits(first, decimal.digits % POW10_64[tail], tail);
+                first += tail;
+            }
+            *first++ = 'e';
+            *first++ = scientific < 0 ? '-' : '+';
+            WriteDigits(first, magnitude, exp_digits);
+            return first + exp_digits;
+        }
+        if (k <= 0)
+        {
+            *first++ = '0';
+            *first++ = '.';
+            for (auto zeros = -k; zeros != 0; --zeros)
+            {
+                *first++ = '0';
+            }
+            WriteDigits(first, decimal.digits, n);
+            return first + n;
+        }
+        const auto whole = static_cast<std::size_t>(k);
+        if (whole < n)
+        {
+            WriteDigits(first, decimal.digits / POW10_64[n - whole], whole);
+            first += whole;
+            *first++ = '.';
+            WriteDigits(first, decimal.digits % POW10_64[n - whole], n - whole);
+            return first + (n - whole);
+        }
+        if (decimal.binary_exponent <= 0)
+        {
+            WriteDigits(first, decimal.mantissa >> -decimal.binary_exponent, whole);
+            return first + whole;
+        }
+        BigInt exact(decimal.mantissa);
+        exact <<= static_cast<std::size_t>(decimal.binary_exponent);
+        for (auto digit = first + whole; digit != first;)
+        {
+            *--digit = static_cast<char>('0' + exact.divide(10));
+        }
+        return first + whole;
+    }
+
+    // Write `text` at `first`, behind a '-' if `negative`, or return `nullptr` if it does not fit.
+    constexpr char* WriteSigned(char* first, char* last, bool negative, std::string_view text) noexcept
+    {
+        if (static_cast<std::size_t>(last - first) < text.size() + negative)
+        {
+            return nullptr;
+        }
+        if (negative)
+        {
+            *first++ = '-';
+        }
+        for (const char ch : text)
+        {
+            *first++ = ch;
+        }
+        return first;
+    }
+
+    template <binary_float T>
+    constexpr bool SignBit(T value) noexcept
+    {
+        using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        return (std::bit_cast<Bits>(value) >> (sizeof(T) * 8 - 1)) != 0;
+    }
+
+    // "nan" or "inf", or "" for a finite value
+    template <binary_float T>
+    constexpr std::string_view NonFinite(T value) noexcept
+    {
+        if (value != value)
+        {
+            return "nan"sv;
+        }
+        if (value > std::numeric_limits<T>::max() || value < std::numeric_limits<T>::lowest())
+        {
+            return "inf"sv;
+        }
+        return ""sv;
+    }
+
+    // the constant evaluation of `FormatFloat()`
+    template <binary_float T>
+    constexpr char* FormatShortest(char* first, char* last, T value) noexcept
+    {
+        const bool negative = SignBit(value);
+        if (const auto special = NonFinite(value); !special.empty())
+        {
+            return WriteSigned(first, last, negative, special);
+        }
+        if (value == 0)
+        {
+            return WriteSigned(first, last, negative, "0"sv);
+        }
+        return WriteDecimal(first, last, negative, ShortestDecimal(negative ? -value : value));
+    }
+
+    // `binary * 10^scale`, rounded to an integer half to even: the digits of a fixed precision, exactly.
+    constexpr BigInt ScaledRound(const Binary& binary, int scale) noexcept
+    {
+        // doubled, so that the last bit of the quotient is the half, and `sticky` tells if anything is left below it
+        BigInt n(binary.mantissa);
+        n <<= 1;
+        if (binary.exponent > 0)
+        {
+            n <<= static_cast<std::size_t>(binary.exponent);
+        }
+        if (scale > 0)
+        {
+            n.mul_pow10(static_cast<std::size_t>(scale));
+        }
+        bool sticky = false;
+        for (auto bits = binary.exponent < 0 ? -binary.exponent : 0; bits != 0;)
+        {
+            const auto step = bits < 31 ? bits : 31;
+            sticky |= n.divide(1u << step) != 0;
+            bits -= step;
+        }
+        for (auto digits = scale < 0 ? -scale : 0; digits != 0;)
+        {
+            const auto step = digits < 9 ? digits : 9;
+            sticky |= n.divide(static_cast<std::uint32_t>(POW10_64[step])) != 0;
+            digits -= step;
+        }
+        if (n.divide(2) != 0 && (sticky || n.is_odd()))
+        {
+            n += BigInt(1);
+        }
+        return n;
+    }
+
+    // the rounded digits of `binary` with `precision` digits after the first one, and the decimal exponent of the first
+    struct Scientific
+    {
+        BigInt digits;
+        int    exponent{0};
+    };
+
+    constexpr Scientific ScientificRound(const Binary& binary, int precision) noexcept
+    {
+        if (binary.mantissa == 0)
+        {
+            return {BigInt(0), 0};
+        }
+        // from an estimate of log10 which is never too high, up to `digits < 10^(precision + 1)`, which also takes
+        // a carry of the rounding into account (9.99 -> 10.0)
+        const auto log2 = binary.exponent + static_cast<int>(std::bit_width(binary.mantissa)) - 1;
+        auto       x    = ((log2 * 1233) >> 12) - 1;
+        BigInt     limit(1);
+        limit.mul_pow10(static_cast<std::size_t>(precision) + 1);
+        for (;; ++x)
+        {
+            auto digits = ScaledRound(binary, precision - x);
+            if (Compare(digits, limit) < 0)
+            {
+                return {digits, x};
+            }
+        }
+    }
+
+    // the number of decimal digits of `n`, 0 for 0
+    constexpr std::size_t CountDigits(BigInt n) noexcept
+    {
+        std::size_t count = 0;
+        for (; !n.is_zero(); n.divide(10))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Write the `count` low decimal digits of `n` backwards from `last`, and return where they start.
+    constexpr char* WriteDigitsBackwards(char* last, BigInt& n, std::size_t count) noexcept
+    {
+        for (; count != 0; --count)
+        {
+            *--last = static_cast<char>('0' + n.divide(10));
+        }
+        return last;
+    }
+
+    // `digits / 10^precision` in the fixed notation, as `printf("%.*f")`
+    constexpr char* WriteFixed(char* first, char* last, bool negative, BigInt digits, std::size_t precision) noexcept
+    {
+        const auto count = CountDigits(digits);
+        const auto whole = count > precision ? count - precision : 1;
+        const auto size  = negative + whole + (precision != 0 ? precision + 1 : 0);
+        if (static_cast<std::size_t>(last - first) < size)
+        {
+            return nullptr;
+        }
+        if (negative)
+        {
+            *first = '-';
+        }
+        auto digit = WriteDigitsBackwards(first + size, digits, precision);
+        if (precision != 0)
+        {
+            *--digit = '.';
+        }
+        WriteDigitsBackwards(digit, digits, whole);
+        return first + size;
+    }
+
+    // `d.ddd * 10^exponent` in the scientific notation, as `printf("%.*e")`
+    constexpr char* WriteScientific(char* first, char* last, bool negative, BigInt digits, std::size_t precision,
+                                    int exponent) noexcept
+    {
+        const auto magnitude  = static_cast<std::uint64_t>(exponent < 0 ? -exponent : exponent);
+        const auto exp_digits = magnitude >= 100 ? std::size_t{3} : std::size_t{2};
+        const auto mantissa   = negative + 1 + (precision != 0 ? precision + 1 : 0);
+        if (static_cast<std::size_t>(last - first) < mantissa + 2 + exp_digits)
+        {
+            return nullptr;
+        }
+        if (negative)
+        {
+            *first = '-';
+        }
+        auto digit = WriteDigitsBackwards(first + mantissa, digits, precision);
+        if (precision != 0)
+        {
+            *--digit = '.';
+        }
+        WriteDigitsBackwards(digit, digits, 1);
+        first += mantissa;
+        *first++ = 'e';
+        *first++ = exponent < 0 ? '-' : '+';
+        WriteDigits(first, magnitude, exp_digits);
+        return first + exp_digits;
+    }
+
+    // Drop the trailing '0's of the fraction in [first, last), and the '.' if nothing is left of it, as `printf("%g")`.
+    constexpr char* StripZeros(char* first, char* last) noexcept
+    {
+        auto mantissa_end = first;
+        for (; mantissa_end != last && *mantissa_end != 'e'; ++mantissa_end)
+        {
+        }
+        auto point = first;
+        for (; point != mantissa_end && *point != '.'; ++point)
+        {
+        }
+        if (point == mantissa_end)
+        {
+            return last;
+        }
+        auto end = mantissa_end;
+        for (; end[-1] == '0'; --end)
+        {
+        }
+        if (end[-1] == '.')
+        {
+            --end;
+        }
+        for (auto tail = mantissa_end; tail != last; ++tail)
+        {
+            *end++ = *tail;
+        }
+        return end;
+    }
+
+    // the constant evaluation of `FormatFloat(first, last, value, format, precision)`
+    template <binary_float T>
+    constexpr char* FormatPrecise(char* first, char* last, T value, std::chars_format format, int precision) noexcept
+    {
+        const bool negative = SignBit(value);
+        if (const auto special = NonFinite(value); !special.empty())
+        {
+            return WriteSigned(first, last, negative, special);
+        }
+        const auto binary = Decompose(negative ? -value : value);
+        if (format == std::chars_format::fixed)
+        {
+            return WriteFixed(first, last, negative, ScaledRound(binary, precision),
+                              static_cast<std::size_t>(precision));
+        }
+        if (format == std::chars_format::scientific)
+        {
+            auto [digits, exponent] = ScientificRound(binary, precision);
+            return WriteScientific(first, last, negative, digits, static_cast<std::size_t>(precision), exponent);
+        }
+        // general: the notation follows the exponent once rounded, and both round the same digits
+        const auto significant  = precision == 0 ? 1 : precision;
+        auto [digits, exponent] = ScientificRound(binary, significant - 1);
+        const auto end          = significant > exponent && exponent >= -4
+                                      ? WriteFixed(first, last, negative, digits,
+                                                   static_cast<std::size_t>(significant - 1 - exponent))
+                                      : WriteScientific(first, last, negative, digits,
+                                                        static_cast<std::size_t>(significant - 1), exponent);
+        return end == nullptr ? nullptr : StripZeros(first, end);
+    }
+}  // namespace __impl
+
+// Render `value` as the shortest decimal which reads back as it, at `first`, writing nothing past `last`. The output is
+// the one of `std::to_chars(first, last, value)`, which it calls at runtime.
+// Returns the end of the chars written, or `nullptr` if they do not fit.
+template <__impl::binary_float T>
+constexpr char* FormatFloat(char* first, char* last, T value) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+        const auto [end, error] = std::to_chars(first, last, value);
+        return error == std::errc{} ? end : nullptr;
+    }
+    return __impl::FormatShortest(first, last, value);
+}
+
+// Render `value` with `precision` digits, after the point (`fixed`, `scientific`) or in all (`general`), at `first`,
+// writing nothing past `last`. The output is the one of `std::to_chars(first, last, value, format, precision)`, which
+// it calls at runtime, and it is rounded exactly, half to even, under constant evaluation.
+// Returns the end of the chars written, or `nullptr` if they do not fit (`general`: before its '0's are dropped).
+template <__impl::binary_float T>
+constexpr char* FormatFloat(char* first, char* last, T value, std::chars_format format, int precision) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+        const auto [end, error] = std::to_chars(first, last, value, format, precision);
+        return error == std::errc{} ? end : nullptr;
+    }
+    return __impl::FormatPrecise(first, last, value, format, precision);
+}
+
+}  // namespace d1::utils::decimal
@@ -36,8 +36,20 @@ public:
         return *this;
     }
 
+    // the container appended to, e.g. for `calgo::copy` to append a whole range at once
+    constexpr Container& container() const noexcept
+    {
+        return _cont;
+    }
+
 private:
     Container& _cont;
 };
 
+template <typename Iterator>
+constexpr bool is_back_insert_iterator = false;
+
+template <typename Container>
+constexpr bool is_back_insert_iterator<back_insert_iterator<Container>> = true;
+
 }  // namespace d1::utils::iterator
\ No newline at end of file
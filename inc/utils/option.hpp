@@ -73,6 +73,10 @@ namespace __impl
 }  // namespace __impl
 
 // `Option` is a Monad
+//
+// It is laid out as a plain flag + storage (`std::optional`), so `is_some()`, `unwrap()` and `>>=` are a flag test and
+// a direct access, no `std::visit` involved. This is what every `ParserOutput` goes through on each combinator
+// boundary.
 template <typename T>
 class Option
 {
@@ -80,46 +84,80 @@ public:
     /* for type traits */
     using value_type = T;
 
-    constexpr Option(const T& t) : _option(__impl::Some(t)) {}
-    constexpr Option(const __impl::Some<T>& t) : _option(t) {}
-    constexpr Option(__impl::None) : _option(__impl::None{}) {}
+    constexpr Option(const T& t) : _option(t) {}
+    constexpr Option(T&& t) : _option(std::move(t)) {}
+    constexpr Option(const __impl::Some<T>& t) : _option(static_cast<const T&>(t)) {}
+    constexpr Option(__impl::None) : _option(std::nullopt) {}
 
-    constexpr auto to_variant() const noexcept
+    /* for pattern matching, prefer `is_some()` and `unwrap_unchecked()` in hot paths */
+    constexpr std::variant<__impl::Some<T>, __impl::None> to_variant() const
     {
-        return _option;
+        if (is_some())
+        {
+            return __impl::Some<T>(*_option);
+        }
+        else
+        {
+            return __impl::None{};
+        }
     }
 
     constexpr bool is_some() const noexcept
     {
-        return _option.index() == 0;
+        return _option.has_value();
     }
 
     constexpr bool is_none() const noexcept
     {
-        return _option.index() == 1;
+        return !_option.has_value();
+    }
+
+    constexpr const T& unwrap() const&
+    {
+        if (is_none())
+        {
+            throw std::runtime_error("unwrapping a `None` value, panic!");
+        }
+        return *_option;
+    }
+
+    constexpr T unwrap() &&
+    {
+        if (is_none())
+        {
+            throw std::runtime_error("unwrapping a `None` value, panic!");
+        }
+        return std::move(*_option);
+    }
+
+    // SAFETY: before calling `unwrap_unchecked()`, please ensure `is_some()` returns true.
+    constexpr const T& unwrap_unchecked() const& noexcept
+    {
+        return *_option;
     }
 
-    constexpr T unwrap() const
+    constexpr T unwrap_unchecked() && noexcept
     {
-        return std::visit(__impl::Overload{[](const __impl::Some<T>& t) -> T { return static_cast<T>(t); },
-                                           [](const __impl::None& _) -> T {
-                                               throw std::runtime_error("unwrapping a `None` value, panic!");
-                                           }},
-                          _option);
+        return std::move(*_option);
     }
 
     /* for gtest */
     template <typename U>
     constexpr __always_inline bool operator==(const Option<U>& rhs) const noexcept
     {
-        return std::is_same_v<T, U> &&
-               ((this->is_none() && rhs.is_none()) ||
-                (this->is_some() && rhs.is_some() &&
-                 std::get<__impl::Some<T>>(this->_option) == std::get<__impl::Some<U>>(rhs._option)));
+        if constexpr (std::is_same_v<T, U>)
+        {
+            return (this->is_none() && rhs.is_none()) ||
+                   (this->is_some() && rhs.is_some() && this->unwrap_unchecked() == rhs.unwrap_unchecked());
+        }
+        else
+        {
+            return false;
+        }
     }
 
 private:
-    std::variant<__impl::Some<T>, __impl::None> _option;
+    std::optional<T> _option;
 };
 
 // unit:: t -> Option<T>
@@ -160,10 +198,29 @@ template <typename T, typename Fn>
 //   requires __impl::bindable_to<T, Fn>
 constexpr auto operator>>=(const Option<T>& opt, Fn&& fn)
 {
-    using U = std::invoke_result_t<Fn, T>;
-    return std::visit(__impl::Overload{[=](const __impl::Some<T>& t) -> U { return fn(static_cast<T>(t)); },
-                                       [](const __impl::None& _) -> U { return NONE; }},
-                      opt.to_variant());
+    using U = std::invoke_result_t<Fn, const T&>;
+    if (opt.is_some())
+    {
+        return fn(opt.unwrap_unchecked());
+    }
+    else
+    {
+        return U(NONE);
+    }
+}
+
+template <typename T, typename Fn>
+constexpr auto operator>>=(Option<T>&& opt, Fn&& fn)
+{
+    using U = std::invoke_result_t<Fn, T&&>;
+    if (opt.is_some())
+    {
+        return fn(std::move(opt).unwrap_unchecked());
+    }
+    else
+    {
+        return U(NONE);
+    }
 }
 
 template <typename Fn1, typename Fn2>
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "./parser.hpp"
+
+namespace fmt
+{
+
+using namespace std::literals;
+
+namespace __impl
+{
+    using d1::core::basic_parser_combinator::__impl::Literal;
+
+    constexpr std::size_t NO_ARG = std::numeric_limits<std::size_t>::max();
+
+    // A slice of the format string, then the index of the argument which follows it (`NO_ARG` for the trailing slice)
+    // and its spec.
+    struct Segment
+    {
+        std::string_view literal{};
+        std::size_t      arg{NO_ARG};
+        Spec             spec{};
+    };
+
+    // literal := [^{}]*
+    constexpr auto literal_parser = d1::TakeUntil("{}"sv);
+
+    // Split `format` into its segments (literal placeholder | literal), call `visit` on each of them, and return how
+    // many there are. The lowered parsers are run in place, so this streams at runtime as well.
+    // Throws `std::invalid_argument` on a brace which does not open a placeholder, or on a bad spec: a bad format
+    // string does not compile.
+    template <typename Visit>
+    constexpr std::size_t ParseSegments(std::string_view format, Visit&& visit)
+    {
+        using d1::core::parser::__impl::Run;
+
+        std::size_t count = 0;
+        for (;; ++count)
+        {
+            std::string_view literal;
+            Run(literal_parser, format, literal);
+            if (format.empty())
+            {
+                if (!literal.empty())
+                {
+                    visit(Segment{literal, NO_ARG});
+                    ++count;
+                }
+                return count;
+            }
+            Placeholder placeholder;
+            if (!Run(placeholder_parser, format, placeholder))
+            {
+                throw std::invalid_argument("unmatched brace in the format string");
+            }
+            visit(Segment{literal, static_cast<std::size_t>(placeholder.arg), placeholder.spec});
+        }
+    }
+}  // namespace __impl
+
+// A format string parsed once, at compile time, into a table of literal slices, argument indices and specs.
+// Rendering walks the table, unrolled: the literals are copied as blocks and the arguments are picked by a constant
+// index, so no parser runs per call. A placeholder without a spec renders as if specs did not exist, and a spec which
+// does not apply to its argument does not compile.
+template <__impl::Literal Str>
+class CompiledFormat
+{
+public:
+    static constexpr std::string_view FORMAT = Str.view();
+
+    static constexpr std::size_t COUNT = __impl::ParseSegments(FORMAT, [](const __impl::Segment&) {});
+
+    static constexpr auto SEGMENTS = []() {
+        std::array<__impl::Segment, COUNT> segments{};
+        std::size_t                        i = 0;
+        __impl::ParseSegments(FORMAT, [&](const __impl::Segment& segment) { segments[i++] = segment; });
+        return segments;
+    }();
+
+    // how many arguments the format string refers to, at least
+    static constexpr std::size_t ARITY = []() {
+        std::size_t arity = 0;
+        for (const auto& segment : SEGMENTS)
+        {
+            if (segment.arg != __impl::NO_ARG)
+            {
+                arity = std::max(arity, segment.arg + 1);
+            }
+        }
+        return arity;
+    }();
+
+    // Throws `std::range_error` if the result does not fit in `Capacity` chars.
+    template <std::size_t Capacity, typename... Args>
+        requires(sizeof...(Args) >= ARITY)
+    constexpr d1::StaticString<char, Capacity> format(const Args&... args) const
+    {
+        d1::StaticString<char, Capacity> out;
+        format_to(out, args...);
+        return out;
+    }
+
+    // Render at the end of `out`, any container with `append(std::string_view)`, `push_back(char)` and
+    // `append_with(write)` (see `StaticVector::append_with()`), e.g. a sink of `sink.hpp`.
+    template <typename Out, typename... Args>
+        requires(sizeof...(Args) >= ARITY)
+    constexpr void format_to(Out& out, const Args&... args) const
+    {
+        const auto packed_args = std::forward_as_tuple(args...);
+        [&]<std::size_t... Idx>(std::index_sequence<Idx...>) {
+            (render<Idx>(out, packed_args), ...);
+        }(std::make_index_sequence<COUNT>{});
+    }
+
+private:
+    template <std::size_t I, typename Out, typename Tuple>
+    static constexpr void render(Out& out, const Tuple& args)
+    {
+        constexpr auto segment = SEGMENTS[I];
+        if constexpr (!segment.literal.empty())
+        {
+            out.append(segment.literal);
+        }
+        if constexpr (segment.arg != __impl::NO_ARG)
+        {
+            const auto& arg = std::get<segment.arg>(args);
+            if constexpr (segment.spec.plain())
+            {
+                __impl::AppendArg(out, arg);
+            }
+            else
+            {
+                static_assert(__impl::CheckSpec<std::remove_cvref_t<decltype(arg)>>(segment.spec));
+                __impl::AppendArg(out, arg, segment.spec);
+            }
+        }
+    }
+};
+
+// Parse a format string at compile time, for the many calls which share it, e.g.
+//     constexpr auto line = fmt::compile<"{0}: {1}">();
+//     line.format<256>(key, value);
+template <__impl::Literal Str>
+constexpr auto compile()
+{
+    return CompiledFormat<Str>{};
+}
+
+}  // namespace fmt
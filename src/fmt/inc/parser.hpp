@@ -1,11 +1,14 @@
 #pragma once
 
+#include <array>
 #include <bits/utility.h>
+#include <concepts>
+#include <cstdint>
 #include <string_view>
-#include <tuple>
 #include <utility>
 
 #include "../../../inc/parser_demo"
+#include "./spec.hpp"
 
 namespace fmt
 {
@@ -14,52 +17,206 @@ using namespace std::literals;
 
 namespace __impl
 {
-    template <typename Tuple>
-    constexpr std::string_view nth_formatted_element(std::size_t n, Tuple&& tuple, std::index_sequence<>)
+    // Render an argument at the end of `out`: the numbers are written in place, with no intermediate string.
+    // Any other argument must convert to `std::string_view`.
+    template <typename Out, typename Arg>
+    constexpr void AppendArg(Out& out, const Arg& arg)
     {
-        return ""sv;
+        if constexpr (std::same_as<Arg, bool>)
+        {
+            out.append(arg ? "true"sv : "false"sv);
+        }
+        else if constexpr (std::same_as<Arg, char>)
+        {
+            out.push_back(arg);
+        }
+        else if constexpr (std::integral<Arg>)
+        {
+            out.append_with([&](char* first, char* last) { return d1::FormatInteger(first, last, arg); });
+        }
+        else if constexpr (std::floating_point<Arg>)
+        {
+            out.append_with([&](char* first, char* last) { return d1::FormatFloat(first, last, arg); });
+        }
+        else
+        {
+            out.append(static_cast<std::string_view>(arg));
+        }
     }
 
-    template <typename Tuple, std::size_t... Idx>
-    constexpr std::string_view nth_formatted_element(std::size_t n, Tuple&& tuple, std::index_sequence<Idx...>)
+    // An argument erased to one of the kinds `AppendArg()` renders. The argument of a placeholder found at runtime is
+    // then an index into an array of them, and it is rendered by a switch over a handful of kinds: O(1) whatever the
+    // number of arguments, and instantiated once rather than once per argument.
+    class FormatArg
     {
-        constexpr std::size_t i = std::index_sequence<Idx...>::size() - 1;
-        if (i == n)
+    public:
+        template <typename Arg>
+        constexpr explicit FormatArg(const Arg& arg)
         {
-            // TODO: call constexpr `to_string()` here
-            return static_cast<std::string_view>(std::get<i>(tuple));
+            if constexpr (std::same_as<Arg, bool>)
+            {
+                _kind    = Kind::Bool;
+                _boolean = arg;
+            }
+            else if constexpr (std::same_as<Arg, char>)
+            {
+                _kind = Kind::Char;
+                _char = arg;
+            }
+            else if constexpr (std::signed_integral<Arg>)
+            {
+                _kind   = Kind::Signed;
+                _signed = arg;
+            }
+            else if constexpr (std::unsigned_integral<Arg>)
+            {
+                _kind     = Kind::Unsigned;
+                _unsigned = arg;
+            }
+            else if constexpr (std::same_as<Arg, float>)
+            {
+                _kind   = Kind::Float;
+                _float = arg;
+            }
+            else if constexpr (std::floating_point<Arg>)
+            {
+                _kind    = Kind::Double;
+                _double = arg;
+            }
+            else
+            {
+                _kind = Kind::String;
+                _str  = static_cast<std::string_view>(arg);
+            }
         }
-        else
+
+        template <typename Out>
+        constexpr void append_to(Out& out) const
+        {
+            switch (_kind)
+            {
+                case Kind::String: out.append(_str); break;
+                case Kind::Signed: AppendArg(out, _signed); break;
+                case Kind::Unsigned: AppendArg(out, _unsigned); break;
+                case Kind::Double: AppendArg(out, _double); break;
+                case Kind::Float: AppendArg(out, _float); break;
+                case Kind::Bool: AppendArg(out, _boolean); break;
+                case Kind::Char: AppendArg(out, _char); break;
+            }
+        }
+
+        // Throws `std::invalid_argument` if `spec` does not apply to the argument.
+        template <typename Out>
+        constexpr void append_to(Out& out, const Spec& spec) const
+        {
+            switch (_kind)
+            {
+                case Kind::String: append_as(out, _str, spec); break;
+                case Kind::Signed: append_as(out, _signed, spec); break;
+                case Kind::Unsigned: append_as(out, _unsigned, spec); break;
+                case Kind::Double: append_as(out, _double, spec); break;
+                case Kind::Float: append_as(out, _float, spec); break;
+                case Kind::Bool: append_as(out, _boolean, spec); break;
+                case Kind::Char: append_as(out, _char, spec); break;
+            }
+        }
+
+    private:
+        template <typename Out, typename Arg>
+        static constexpr void append_as(Out& out, const Arg& arg, const Spec& spec)
         {
-            return nth_formatted_element(n, tuple, std::make_index_sequence<i>{});
+            CheckSpec<Arg>(spec);
+            AppendArg(out, arg, spec);
+        }
+
+        enum class Kind : std::uint8_t
+        {
+            String,
+            Signed,
+            Unsigned,
+            Double,
+            Float,
+            Bool,
+            Char,
+        };
+
+        Kind _kind{Kind::String};
+        union
+        {
+            std::string_view _str;
+            std::int64_t     _signed;
+            std::uint64_t    _unsigned;
+            double           _double;
+            float            _float;
+            bool             _boolean;
+            char             _char;
+        };
+    };
+
+    template <typename... Args>
+    constexpr auto MakeFormatArgs(const Args&... args)
+    {
+        return std::array<FormatArg, sizeof...(Args)>{FormatArg(args)...};
+    }
+
+    // Append the `n`th argument (nothing if there is none).
+    template <typename Out, std::size_t N>
+    constexpr void AppendNthArg(Out& out, std::size_t n, const std::array<FormatArg, N>& args)
+    {
+        if (n < N)
+        {
+            args[n].append_to(out);
         }
     }
 
+    // Append the `n`th argument as `spec` (nothing if there is none), straight on when there is no spec.
+    template <typename Out, std::size_t N>
+    constexpr void AppendNthArg(Out& out, std::size_t n, const std::array<FormatArg, N>& args, const Spec& spec)
+    {
+        if (n < N)
+        {
+            if (spec.plain())
+            {
+                args[n].append_to(out);
+            }
+            else
+            {
+                args[n].append_to(out, spec);
+            }
+        }
+    }
+
+    struct Placeholder
+    {
+        std::uint64_t arg{0};
+        Spec          spec{};
+    };
 }  // namespace __impl
 
 constexpr auto indexer_parser = d1::ParseChar('{') >> d1::uint64_parser << d1::ParseChar('}');
 
+// placeholder := '{' index [':' spec] '}', e.g. `{0:>8}`, `{1:08x}`, `{2:.3}`
+constexpr auto placeholder_parser =
+    d1::Combine(d1::ParseChar('{') >> d1::uint64_parser,
+                d1::Try(d1::ParseChar(':') >> __impl::spec_parser, __impl::Spec{}) << d1::ParseChar('}'),
+                [](std::uint64_t arg, const __impl::Spec& spec) { return __impl::Placeholder{arg, spec}; });
+
 template <std::size_t Capacity>
-constexpr auto str_parser =
-    d1::Many(d1::ParseNoneOfChars("{}"), d1::StaticString<char, Capacity>(), [](auto acc, char ch) {
-        acc.push_back(ch);
-        return acc;
-    });
+constexpr auto str_parser = d1::Many(d1::ParseNoneOfChars("{}"), d1::StaticString<char, Capacity>(),
+                                     [](auto& acc, char ch) { acc.push_back(ch); });
 
 template <std::size_t ElemCapacity, std::size_t Capacity, typename... Args>
-// requrires Args has a constexpr `to_string()`
+// requires Args are numbers, or convert to `std::string_view`
 constexpr auto format_parser = [](d1::ParserInput code, Args&&... args) {
-    const auto packed_args        = std::make_tuple(args...);
-    const auto format_elem_parser = Combine(str_parser<ElemCapacity>, indexer_parser, [=](auto str, std::uint64_t n) {
-        // then we can call nth_arg.to_string() here to build string at compile time
-        const auto nth_arg = __impl::nth_formatted_element(
-            n, packed_args, std::make_index_sequence<std::tuple_size_v<std::tuple<Args...>>>{});
-        d1::copy(std::begin(nth_arg), std::end(nth_arg), d1::back_insert_iterator(str));
-        return str;
-    });
-    return Many(format_elem_parser, d1::StaticString<char, Capacity>(), [](auto acc, auto str) {
+    const auto packed_args        = __impl::MakeFormatArgs(args...);
+    const auto format_elem_parser = d1::Combine(str_parser<ElemCapacity>, placeholder_parser,
+                                                [=](auto str, const __impl::Placeholder& placeholder) {
+                                                    __impl::AppendNthArg(str, placeholder.arg, packed_args,
+                                                                         placeholder.spec);
+                                                    return str;
+                                                });
+    return d1::Many(format_elem_parser, d1::StaticString<char, Capacity>(), [](auto& acc, const auto& str) {
         d1::copy(str.begin(), str.end(), d1::back_insert_iterator(acc));
-        return acc;
     })(code);
 };
 
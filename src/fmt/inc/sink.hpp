@@ -0,0 +1,297 @@
+#pragma once
+
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <unistd.h>
+
+#include "./compile.hpp"
+#include "./parser.hpp"
+
+namespace fmt
+{
+
+using namespace std::literals;
+
+namespace __impl
+{
+    // the longest number `AppendArg()` renders: a `double` takes up to 24 chars, an integer up to 20
+    constexpr std::size_t MAX_NUMBER_CHARS = 32;
+
+    using NumberWriter = char* (*)(char*, char*);
+
+    // Where `format_to()` renders into: a string, or a sink below.
+    template <typename Out>
+    concept sink = requires(Out& out, std::string_view str, char ch, NumberWriter write) {
+        out.append(str);
+        out.push_back(ch);
+        out.append_with(write);
+    };
+
+    using d1::core::input::__impl::ThrowErrno;
+}  // namespace __impl
+
+// Buffers the output for a file descriptor, and writes it out with `::write` when the buffer is full, on `flush()` and
+// on destruction: one syscall per `BufferSize` bytes, whatever the number of `format_to()` calls.
+// The descriptor is not owned. Throws `std::system_error` if a write fails (except on destruction, where it is lost).
+template <std::size_t BufferSize = 4096>
+class FdWriter
+{
+    static_assert(BufferSize >= __impl::MAX_NUMBER_CHARS, "the buffer must fit any number");
+
+public:
+    explicit FdWriter(int fd) noexcept : _fd(fd) {}
+
+    FdWriter(const FdWriter&)            = delete;
+    FdWriter& operator=(const FdWriter&) = delete;
+
+    ~FdWriter()
+    {
+        drain();
+    }
+
+    void append(std::string_view str)
+    {
+        if (str.size() > BufferSize - _used)
+        {
+            flush();
+            if (str.size() >= BufferSize)
+            {
+                write_all(str);
+                return;
+            }
+        }
+        std::memcpy(_buffer + _used, str.data(), str.size());
+        _used += str.size();
+    }
+
+    void push_back(char ch)
+    {
+        if (_used == BufferSize)
+        {
+            flush();
+        }
+        _buffer[_used++] = ch;
+    }
+
+    // see `StaticVector::append_with()`, `write` is given at least `MAX_NUMBER_CHARS` chars
+    template <typename Write>
+    void append_with(Write&& write)
+    {
+        if (BufferSize - _used < __impl::MAX_NUMBER_CHARS)
+        {
+            flush();
+        }
+        const auto last = write(_buffer + _used, _buffer + BufferSize);
+        if (last == nullptr)
+        {
+            throw std::range_error("rendering does not fit the buffer!");
+        }
+        _used = static_cast<std::size_t>(last - _buffer);
+    }
+
+    void flush()
+    {
+        if (!drain())
+        {
+            __impl::ThrowErrno("write");
+        }
+    }
+
+private:
+    // write the buffer out, false on error (`errno` is set, and the buffer is lost)
+    bool drain() noexcept
+    {
+        const auto used = std::exchange(_used, 0);
+        return write_chars(_buffer, used);
+    }
+
+    void write_all(std::string_view str)
+    {
+        if (!write_chars(str.data(), str.size()))
+        {
+            __impl::ThrowErrno("write");
+        }
+    }
+
+    bool write_chars(const char* data, std::size_t size) noexcept
+    {
+        while (size != 0)
+        {
+            const auto written = ::write(_fd, data, size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+    int         _fd;
+    std::size_t _used{0};
+    char        _buffer[BufferSize];
+};
+
+// Writes into a buffer of the caller, and cuts the output at its end, like `snprintf`: `truncated()` reports it, and
+// `required()` is the size the whole output would take, to retry with a buffer large enough.
+class SpanSink
+{
+public:
+    constexpr explicit SpanSink(std::span<char> buffer) noexcept : _buffer(buffer) {}
+
+    constexpr void append(std::string_view str) noexcept
+    {
+        const auto spare = _buffer.size() - _size;
+        const auto count = str.size() < spare ? str.size() : spare;
+        d1::copy(str.data(), str.data() + count, _buffer.data() + _size);
+        _size += count;
+        _required += str.size();
+    }
+
+    constexpr void push_back(char ch) noexcept
+    {
+        if (_size != _buffer.size())
+        {
+            _buffer[_size++] = ch;
+        }
+        ++_required;
+    }
+
+    // see `StaticVector::append_with()`, what does not fit is rendered aside, then cut
+    template <typename Write>
+    constexpr void append_with(Write&& write)
+    {
+        const auto first = _buffer.data() + _size;
+        if (const auto last = write(first, _buffer.data() + _buffer.size()); last != nullptr)
+        {
+            _size = static_cast<std::size_t>(last - _buffer.data());
+            _required += static_cast<std::size_t>(last - first);
+            return;
+        }
+        char aside[__impl::MAX_NUMBER_CHARS] = {};
+        append({aside, static_cast<std::size_t>(write(aside, aside + sizeof(aside)) - aside)});
+    }
+
+    // what was written
+    constexpr std::string_view view() const noexcept
+    {
+        return {_buffer.data(), _size};
+    }
+
+    constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    constexpr std::size_t required() const noexcept
+    {
+        return _required;
+    }
+
+    constexpr bool truncated() const noexcept
+    {
+        return _required > _size;
+    }
+
+private:
+    std::span<char> _buffer;
+    std::size_t     _size{0};
+    std::size_t     _required{0};
+};
+
+// The sink of an output iterator of chars, e.g. `std::back_inserter(str)` or a `char*`.
+template <std::output_iterator<char> OutputIt>
+class IteratorSink
+{
+public:
+    constexpr explicit IteratorSink(OutputIt it) : _it(std::move(it)) {}
+
+    constexpr void append(std::string_view str)
+    {
+        _it = d1::copy(str.begin(), str.end(), std::move(_it));
+    }
+
+    constexpr void push_back(char ch)
+    {
+        *_it = ch;
+        ++_it;
+    }
+
+    // see `StaticVector::append_with()`, rendered aside first: an iterator has no spare capacity
+    template <typename Write>
+    constexpr void append_with(Write&& write)
+    {
+        char aside[__impl::MAX_NUMBER_CHARS] = {};
+        append({aside, static_cast<std::size_t>(write(aside, aside + sizeof(aside)) - aside)});
+    }
+
+    // past the output
+    constexpr OutputIt position() const
+    {
+        return _it;
+    }
+
+private:
+    OutputIt _it;
+};
+
+namespace __impl
+{
+    // Run `render` on `out`, a sink, or on the sink of `out`, an output iterator, then returned past the output.
+    template <typename Out, typename Render>
+    constexpr decltype(auto) RenderTo(Out&& out, Render&& render)
+    {
+        if constexpr (sink<std::remove_cvref_t<Out>>)
+        {
+            render(out);
+        }
+        else
+        {
+            IteratorSink<std::decay_t<Out>> iterator_sink(std::forward<Out>(out));
+            render(iterator_sink);
+            return iterator_sink.position();
+        }
+    }
+}  // namespace __impl
+
+// Render a format string, parsed at compile time, straight into a sink (`FdWriter`, `SpanSink`, a `StaticString`, an
+// `ArenaString`...) or through an output iterator, which is returned past the output: no intermediate string, and no
+// limit but the sink's.
+template <__impl::Literal Str, typename Out, typename... Args>
+constexpr decltype(auto) format_to(Out&& out, const Args&... args)
+{
+    return __impl::RenderTo(std::forward<Out>(out),
+                            [&](auto& sink) { CompiledFormat<Str>{}.format_to(sink, args...); });
+}
+
+// Render a format string known at runtime only, segment by segment as it is parsed, into a sink or through an output
+// iterator (see above).
+// Throws `std::invalid_argument` on a brace which does not open a placeholder, or on a spec which does not apply to its
+// argument, after the segments before it are rendered.
+template <typename Out, typename... Args>
+constexpr decltype(auto) format_to(Out&& out, std::string_view format, const Args&... args)
+{
+    const auto packed_args = __impl::MakeFormatArgs(args...);
+    return __impl::RenderTo(std::forward<Out>(out), [&](auto& sink) {
+        __impl::ParseSegments(format, [&](const __impl::Segment& segment) {
+            sink.append(segment.literal);
+            __impl::AppendNthArg(sink, segment.arg, packed_args, segment.spec);
+        });
+    });
+}
+
+}  // namespace fmt
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#include "../../../inc/parser_demo"
+
+namespace fmt
+{
+
+using namespace std::literals;
+
+namespace __impl
+{
+    constexpr std::size_t NO_PRECISION = std::numeric_limits<std::size_t>::max();
+
+    // the widest precision of a spec: a `double` then takes up to 309 + 1 + 64 chars in the fixed notation
+    constexpr std::size_t MAX_PRECISION  = 64;
+    constexpr std::size_t MAX_SPEC_CHARS = 384;
+
+    // The spec of a placeholder, `[[fill]align][sign]['#']['0'][width]['.' precision][type]` as in `std::format`, with
+    // what its type implies worked out as it is parsed: the base of an integer, and the notation and precision of a
+    // float. Rendering only measures the argument to pad it.
+    struct Spec
+    {
+        char        fill{' '};
+        char        align{'\0'};  // '<', '>', '^', or '\0': right for the numbers, left for the rest
+        char        sign{'-'};    // '-', '+' or ' '
+        bool        alternate{false};
+        bool        zero_pad{false};
+        std::size_t width{0};
+        std::size_t precision{NO_PRECISION};
+        char        type{'\0'};
+
+        unsigned          base{10};
+        bool              upper{false};
+        std::chars_format float_format{};  // `{}` for the shortest decimal
+
+        constexpr bool operator==(const Spec&) const = default;
+
+        // `{N}`, or `{N:}`
+        constexpr bool plain() const noexcept
+        {
+            return *this == Spec{};
+        }
+    };
+
+    struct FillAlign
+    {
+        char fill{' '};
+        char align{'\0'};
+    };
+
+    // Work out what the type of `spec` implies. Throws `std::invalid_argument` on a precision past `MAX_PRECISION`.
+    constexpr Spec Complete(Spec spec)
+    {
+        if (spec.precision != NO_PRECISION && spec.precision > MAX_PRECISION)
+        {
+            throw std::invalid_argument("precision too large in the format string");
+        }
+        switch (spec.type)
+        {
+            case 'b': spec.base = 2; break;
+            case 'o': spec.base = 8; break;
+            case 'x': spec.base = 16; break;
+            case 'X':
+                spec.base  = 16;
+                spec.upper = true;
+                break;
+            case 'e': spec.float_format = std::chars_format::scientific; break;
+            case 'f': spec.float_format = std::chars_format::fixed; break;
+            case 'g': spec.float_format = std::chars_format::general; break;
+            default:
+                if (spec.precision != NO_PRECISION)
+                {
+                    spec.float_format = std::chars_format::general;
+                }
+                break;
+        }
+        if (spec.float_format != std::chars_format{} && spec.precision == NO_PRECISION)
+        {
+            spec.precision = 6;
+        }
+        return spec;
+    }
+
+    constexpr auto align_parser = d1::ParseOneOfChars("<>^");
+
+    // [[fill]align], the fill is any char but a brace
+    constexpr auto fill_align_parser =
+        d1::Combine(d1::ParseNoneOfChars("{}"), align_parser,
+                    [](char fill, char align) { return FillAlign{fill, align}; }) ||
+        d1::Map(align_parser, [](char align) { return FillAlign{' ', align}; });
+
+    // The parts are all optional, each one is folded into the spec in turn.
+    constexpr auto spec_parser = []() {
+        const auto with_align = d1::Map(d1::Try(fill_align_parser, FillAlign{}), [](FillAlign fill_align) {
+            Spec spec;
+            spec.fill  = fill_align.fill;
+            spec.align = fill_align.align;
+            return spec;
+        });
+        const auto with_sign =
+            d1::Combine(with_align, d1::Try(d1::ParseOneOfChars("+- "), '-'), [](Spec spec, char sign) {
+                spec.sign = sign;
+                return spec;
+            });
+        const auto with_alternate = d1::Combine(with_sign, d1::Try(d1::ParseChar('#'), '\0'), [](Spec spec, char ch) {
+            spec.alternate = ch == '#';
+            return spec;
+        });
+        const auto with_zero_pad =
+            d1::Combine(with_alternate, d1::Try(d1::ParseChar('0'), '\0'), [](Spec spec, char ch) {
+                spec.zero_pad = ch == '0';
+                return spec;
+            });
+        const auto with_width = d1::Combine(with_zero_pad, d1::Try(d1::uint64_parser, std::uint64_t{0}),
+                                            [](Spec spec, std::uint64_t width) {
+                                                spec.width = static_cast<std::size_t>(width);
+                                                return spec;
+                                            });
+        const auto with_precision =
+            d1::Combine(with_width, d1::Try(d1::ParseChar('.') >> d1::uint64_parser, std::uint64_t{NO_PRECISION}),
+                        [](Spec spec, std::uint64_t precision) {
+                            spec.precision = static_cast<std::size_t>(precision);
+                            return spec;
+                        });
+        return d1::Combine(with_precision, d1::Try(d1::ParseOneOfChars("bcdefgosxX"), '\0'),
+                           [](Spec spec, char type) {
+                               spec.type = type;
+                               return Complete(spec);
+                           });
+    }();
+
+    // Check that `spec` applies to an `Arg`, as `AppendArg(out, arg, spec)` renders it; true, or throws
+    // `std::invalid_argument`. Run in a `static_assert` for a format string compiled, a bad spec does not compile.
+    template <typename Arg>
+    constexpr bool CheckSpec(const Spec& spec)
+    {
+        constexpr bool integer = std::integral<Arg> && !std::same_as<Arg, bool> && !std::same_as<Arg, char>;
+        constexpr bool number  = integer || std::floating_point<Arg>;
+
+        auto types = "s"sv;
+        if constexpr (std::same_as<Arg, char>)
+        {
+            types = "cs"sv;
+        }
+        else if constexpr (integer)
+        {
+            types = "bdoxX"sv;
+        }
+        else if constexpr (std::floating_point<Arg>)
+        {
+            types = "efg"sv;
+        }
+        if (spec.type != '\0' && types.find(spec.type) == std::string_view::npos)
+        {
+            throw std::invalid_argument("format type does not apply to the argument");
+        }
+        if (!number && (spec.sign != '-' || spec.zero_pad))
+        {
+            throw std::invalid_argument("sign and '0' only apply to numbers");
+        }
+        if (!integer && spec.alternate)
+        {
+            throw std::invalid_argument("'#' only applies to integers");
+        }
+        if (std::integral<Arg> && spec.precision != NO_PRECISION)
+        {
+            throw std::invalid_argument("precision does not apply to the argument");
+        }
+        return true;
+    }
+
+    // the fill before and after a body, and the '0's between its sign and its digits
+    struct Padding
+    {
+        std::size_t before{0};
+        std::size_t zeros{0};
+        std::size_t after{0};
+    };
+
+    constexpr Padding PadFor(const Spec& spec, std::size_t size, bool number) noexcept
+    {
+        if (spec.width <= size)
+        {
+            return {};
+        }
+        const auto pad = spec.width - size;
+        if (spec.zero_pad && spec.align == '\0')
+        {
+            return {0, pad, 0};
+        }
+        const auto align  = spec.align != '\0' ? spec.align : number ? '>' : '<';
+        const auto before = align == '>' ? pad : align == '^' ? pad / 2 : 0;
+        return {before, 0, pad - before};
+    }
+
+    template <typename Out>
+    constexpr void AppendFill(Out& out, char fill, std::size_t count)
+    {
+        for (; count != 0; --count)
+        {
+            out.push_back(fill);
+        }
+    }
+
+    // Render `prefix` (a sign, a base), then `body`, padded to the width of `spec`.
+    template <typename Out>
+    constexpr void AppendPadded(Out& out, const Spec& spec, std::string_view prefix, std::string_view body,
+                                bool number)
+    {
+        const auto padding = PadFor(spec, prefix.size() + body.size(), number);
+        AppendFill(out, spec.fill, padding.before);
+        out.append(prefix);
+        AppendFill(out, '0', padding.zeros);
+        out.append(body);
+        AppendFill(out, spec.fill, padding.after);
+    }
+
+    // Render an argument at the end of `out` as `spec`, which `CheckSpec()` accepts for it. The digits are written
+    // aside first, to be measured.
+    template <typename Out, typename Arg>
+    constexpr void AppendArg(Out& out, const Arg& arg, const Spec& spec)
+    {
+        if constexpr (std::integral<Arg> && !std::same_as<Arg, bool> && !std::same_as<Arg, char>)
+        {
+            using U        = std::make_unsigned_t<Arg>;
+            bool negative  = false;
+            auto magnitude = static_cast<std::uint64_t>(static_cast<U>(arg));
+            if constexpr (std::is_signed_v<Arg>)
+            {
+                if (arg < 0)
+                {
+                    negative  = true;
+                    magnitude = static_cast<std::uint64_t>(static_cast<U>(U{0} - static_cast<U>(arg)));
+                }
+            }
+
+            char        prefix[4]{};
+            std::size_t prefix_size = 0;
+            if (negative || spec.sign != '-')
+            {
+                prefix[prefix_size++] = negative ? '-' : spec.sign;
+            }
+            if (spec.alternate && spec.base != 10 && !(spec.base == 8 && magnitude == 0))
+            {
+                prefix[prefix_size++] = '0';
+                if (spec.base != 8)
+                {
+                    prefix[prefix_size++] = spec.base == 2 ? 'b' : spec.upper ? 'X' : 'x';
+                }
+            }
+
+            char       digits[64];
+            const auto count = d1::CountDigits(magnitude, spec.base);
+            d1::WriteDigits(digits, magnitude, count, spec.base, spec.upper);
+            AppendPadded(out, spec, {prefix, prefix_size}, {digits, count}, true);
+        }
+        else if constexpr (std::floating_point<Arg>)
+        {
+            char       body[MAX_SPEC_CHARS];
+            const auto last = spec.float_format == std::chars_format{}
+                                  ? d1::FormatFloat(body, body + sizeof(body), arg)
+                                  : d1::FormatFloat(body, body + sizeof(body), arg, spec.float_format,
+                                                    static_cast<int>(spec.precision));
+            auto       first  = body;
+            auto       prefix = ""sv;
+            if (*first == '-')
+            {
+                prefix = "-"sv;
+                ++first;
+            }
+            else if (spec.sign != '-')
+            {
+                prefix = spec.sign == '+' ? "+"sv : " "sv;
+            }
+            // nan and inf are padded with the fill, not with '0's
+            auto       padded = spec;
+            const bool finite = *first >= '0' && *first <= '9';
+            padded.zero_pad   = spec.zero_pad && finite;
+            AppendPadded(out, padded, prefix, {first, static_cast<std::size_t>(last - first)}, true);
+        }
+        else
+        {
+            auto str = ""sv;
+            if constexpr (std::same_as<Arg, bool>)
+            {
+                str = arg ? "true"sv : "false"sv;
+            }
+            else if constexpr (std::same_as<Arg, char>)
+            {
+                str = {&arg, 1};
+            }
+            else
+            {
+                str = static_cast<std::string_view>(arg);
+            }
+            if (spec.precision < str.size())
+            {
+                str = str.substr(0, spec.precision);
+            }
+            AppendPadded(out, spec, {}, str, false);
+        }
+    }
+}  // namespace __impl
+
+}  // namespace fmt
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "../inc/compile.hpp"
+
+using namespace std::literals;
+
+TEST(CompiledFormatter, Segments)
+{
+    constexpr auto line = fmt::compile<"id={0}, name={1}!">();
+
+    static_assert(line.COUNT == 3);
+    static_assert(line.ARITY == 2);
+    static_assert(line.SEGMENTS[0].literal == "id="sv && line.SEGMENTS[0].arg == 0);
+    static_assert(line.SEGMENTS[1].literal == ", name="sv && line.SEGMENTS[1].arg == 1);
+    static_assert(line.SEGMENTS[2].literal == "!"sv && line.SEGMENTS[2].arg == fmt::__impl::NO_ARG);
+
+    static_assert(fmt::compile<"">().COUNT == 0);
+    static_assert(fmt::compile<"{1}{0}">().COUNT == 2);
+}
+
+TEST(CompiledFormatter, CompileTime)
+{
+    constexpr auto result = fmt::compile<"This is a {1} test by {0}.">().format<128>("ZYUJLIN"sv, "formatter"sv);
+
+    static_assert(result.to_string_view() == "This is a formatter test by ZYUJLIN."sv);
+    static_assert(fmt::compile<"no args">().format<16>().to_string_view() == "no args"sv);
+}
+
+TEST(CompiledFormatter, Runtime)
+{
+    const auto line = fmt::compile<"{0}={1}; {0}">();
+    const auto key  = std::string("key");
+    const auto val  = std::string("value");
+
+    EXPECT_EQ(line.format<32>(std::string_view(key), std::string_view(val)).to_string_view(), "key=value; key"sv);
+    EXPECT_THROW(line.format<8>(std::string_view(key), std::string_view(val)), std::range_error);
+}
+
+TEST(CompiledFormatter, UnmatchedBrace)
+{
+    EXPECT_THROW(fmt::__impl::ParseSegments("a {x} b"sv, [](const auto&) {}), std::invalid_argument);
+    EXPECT_THROW(fmt::__impl::ParseSegments("a } b"sv, [](const auto&) {}), std::invalid_argument);
+}
+
+TEST(CompiledFormatter, Numbers)
+{
+    constexpr auto line = fmt::compile<"{0} + {1} = {2} ({3}, {4})">();
+
+    static_assert(line.format<64>(-1, 2u, 0.5, true, 'c').to_string_view() == "-1 + 2 = 0.5 (true, c)"sv);
+    EXPECT_EQ(line.format<64>(std::int64_t{-9}, 1e22, 1.25f, false, '!').to_string_view(),
+              "-9 + 1e+22 = 1.25 (false, !)"sv);
+    EXPECT_THROW(line.format<16>(123456789, 987654321, 2.0, false, 'x'), std::range_error);
+}
@@ -19,4 +19,32 @@ TEST(CompileTimeFormatter, MultiArgs)
         "This is a {1} test by {0}"sv, "ZYUJLIN"sv, "formatter"sv);
 
     static_assert(result.unwrap().first == "This is a formatter test by ZYUJLIN"sv);
-}
\ No newline at end of file
+}
+
+TEST(CompileTimeFormatter, Numbers)
+{
+    constexpr auto result =
+        fmt::format_parser<128, 1024, int, double, std::string_view>("#{0}/{1}: {2}"sv, 42, 0.25, "ok"sv);
+
+    static_assert(result.unwrap().first == "#42/0.25: ok"sv);
+}
+
+TEST(CompileTimeFormatter, ManyArgs)
+{
+    constexpr auto result =
+        fmt::format_parser<128, 1024, int, unsigned, long, char, bool, float, double, std::string_view, short, char>(
+            "#{9},{8},{7},{6},{5},{4},{3},{2},{1},{0},{10}"sv, 0, 1u, -2l, '3', true, 0.5f, 0.25, "sv"sv, short{-8},
+            '9');
+
+    static_assert(result.unwrap().first == "#9,-8,sv,0.25,0.5,true,3,-2,1,0,"sv);
+}
+
+TEST(CompileTimeFormatter, Specs)
+{
+    constexpr auto result = fmt::format_parser<128, 1024, int, unsigned, double, std::string_view>(
+        "[{0:>8}|{1:08x}|{2:.3}|{3:*^6}]"sv, 42, 255u, 3.14159, "ab"sv);
+
+    // the literal after the last placeholder is left over
+    static_assert(result.unwrap().first == "[      42|000000ff|3.14|**ab**"sv);
+    static_assert(result.unwrap().second == "]"sv);
+}
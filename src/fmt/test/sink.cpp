@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <unistd.h>
+
+#include "../inc/sink.hpp"
+
+using namespace std::literals;
+
+TEST(FormatTo, SpanSink)
+{
+    char buffer[16];
+    auto sink = fmt::SpanSink(buffer);
+    fmt::format_to<"{0}={1}">(sink, "key"sv, 42);
+
+    EXPECT_EQ(sink.view(), "key=42"sv);
+    EXPECT_FALSE(sink.truncated());
+
+    // cut at the end of the buffer, a number as well as a string
+    fmt::format_to<", {0}, {1}">(sink, 1234567, "tail"sv);
+
+    EXPECT_EQ(sink.view(), "key=42, 1234567,"sv);
+    EXPECT_TRUE(sink.truncated());
+    EXPECT_EQ(sink.required(), "key=42, 1234567, tail"sv.size());
+}
+
+TEST(FormatTo, ConstexprSpanSink)
+{
+    constexpr auto result = []() {
+        std::array<char, 8> buffer{};
+        auto                sink = fmt::SpanSink(buffer);
+        fmt::format_to<"{0}-{1}">(sink, -1.5, 'x');
+        return std::pair(buffer, sink.size());
+    }();
+
+    static_assert(std::string_view(result.first.data(), result.second) == "-1.5-x"sv);
+}
+
+TEST(FormatTo, OutputIterator)
+{
+    std::string out;
+    fmt::format_to<"[{0}|{1}]">(std::back_inserter(out), "a"sv, 0.125);
+
+    EXPECT_EQ(out, "[a|0.125]");
+
+    char       buffer[32];
+    const auto last = fmt::format_to(buffer, "{1}{0}!"sv, true, 7u);
+
+    EXPECT_EQ(std::string_view(buffer, last), "7true!"sv);
+}
+
+TEST(FormatTo, RuntimeFormatString)
+{
+    d1::StaticString<char, 64> out;
+    fmt::format_to(out, "{0} of {1} at {2}%"sv, 3, 4, 75.5);
+
+    EXPECT_EQ(out.to_string_view(), "3 of 4 at 75.5%"sv);
+    EXPECT_THROW(fmt::format_to(out, "{0} {"sv, 1), std::invalid_argument);
+}
+
+TEST(FormatTo, ArenaStringHasNoLimit)
+{
+    d1::Arena      arena;
+    d1::ArenaScope scope(arena);
+
+    d1::ArenaString<char> out;
+    std::string           expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        fmt::format_to<"{0}:{1};">(out, i, "value"sv);
+        expected += std::to_string(i) + ":value;";
+    }
+
+    EXPECT_EQ(out, expected);
+}
+
+TEST(FormatTo, FdWriter)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    std::string expected;
+    {
+        // more than the buffer, in small writes and in a large one
+        auto writer = fmt::FdWriter<64>(fds[1]);
+        for (int i = 0; i < 100; ++i)
+        {
+            fmt::format_to<"line {0}: {1}\n">(writer, i, -i);
+            expected += "line " + std::to_string(i) + ": " + std::to_string(-i) + "\n";
+        }
+        const auto large = std::string(200, 'x');
+        fmt::format_to<"{0}">(writer, std::string_view(large));
+        expected += large;
+    }
+    ::close(fds[1]);
+
+    std::string written;
+    char        buffer[256];
+    for (ssize_t n; (n = ::read(fds[0], buffer, sizeof(buffer))) > 0;)
+    {
+        written.append(buffer, static_cast<std::size_t>(n));
+    }
+    ::close(fds[0]);
+
+    EXPECT_EQ(written, expected);
+}
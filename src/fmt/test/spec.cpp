@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "../inc/compile.hpp"
+#include "../inc/sink.hpp"
+
+using namespace std::literals;
+
+namespace
+{
+// the spec of the only placeholder of `format`
+constexpr fmt::__impl::Spec SpecOf(std::string_view format)
+{
+    fmt::__impl::Spec spec;
+    fmt::__impl::ParseSegments(format, [&](const fmt::__impl::Segment& segment) {
+        if (segment.arg != fmt::__impl::NO_ARG)
+        {
+            spec = segment.spec;
+        }
+    });
+    return spec;
+}
+}  // namespace
+
+TEST(FormatSpec, Parse)
+{
+    static_assert(SpecOf("{0}"sv).plain() && SpecOf("{0:}"sv).plain());
+
+    constexpr auto padded = SpecOf("{0:*^+#010.3x}"sv);
+    static_assert(padded.fill == '*' && padded.align == '^' && padded.sign == '+' && padded.alternate);
+    static_assert(padded.zero_pad && padded.width == 10 && padded.precision == 3 && padded.type == 'x');
+    static_assert(padded.base == 16 && !padded.upper);
+
+    static_assert(SpecOf("{0:<}"sv).fill == ' ' && SpecOf("{0:<}"sv).align == '<');
+    static_assert(SpecOf("{0:08}"sv).zero_pad && SpecOf("{0:08}"sv).width == 8);
+    static_assert(SpecOf("{0:X}"sv).upper && SpecOf("{0:b}"sv).base == 2);
+    static_assert(SpecOf("{0:f}"sv).float_format == std::chars_format::fixed && SpecOf("{0:f}"sv).precision == 6);
+    static_assert(SpecOf("{0:.3}"sv).float_format == std::chars_format::general);
+
+    EXPECT_THROW(SpecOf("{0:z}"sv), std::invalid_argument);
+    EXPECT_THROW(SpecOf("{0:>8"sv), std::invalid_argument);
+    EXPECT_THROW(SpecOf("{0:.65}"sv), std::invalid_argument);
+}
+
+TEST(FormatSpec, CompileTime)
+{
+    static_assert(fmt::compile<"[{0:>8}]">().format<32>(42).to_string_view() == "[      42]"sv);
+    static_assert(fmt::compile<"[{0:08x}]">().format<32>(255).to_string_view() == "[000000ff]"sv);
+    static_assert(fmt::compile<"[{0:.3}]">().format<32>(3.14159).to_string_view() == "[3.14]"sv);
+    static_assert(fmt::compile<"[{0:.3f}]">().format<32>(2.0).to_string_view() == "[2.000]"sv);
+    static_assert(fmt::compile<"[{0:*^7}]">().format<32>("abc"sv).to_string_view() == "[**abc**]"sv);
+    static_assert(fmt::compile<"[{0:<4}|{1:>6}]">().format<32>(true, 'c').to_string_view() == "[true|     c]"sv);
+    static_assert(fmt::compile<"[{0:.2}]">().format<32>("abcdef"sv).to_string_view() == "[ab]"sv);
+}
+
+TEST(FormatSpec, Integers)
+{
+    const auto line = fmt::compile<"{0:+} {1:#x} {2:#X} {3:#o} {4:#b} {5:08} {6:^6} {7: d}">();
+
+    EXPECT_EQ(line.format<128>(7, 255, 255u, 8, std::uint8_t{5}, -42, 3, 9).to_string_view(),
+              "+7 0xff 0XFF 010 0b101 -0000042   3     9"sv);
+    EXPECT_EQ(fmt::compile<"{0:#o}/{1:b}">().format<128>(0, std::numeric_limits<std::uint64_t>::max()).to_string_view(),
+              "0/" + std::string(64, '1'));
+    EXPECT_EQ(fmt::compile<"{0:#010x}">().format<32>(std::numeric_limits<std::int64_t>::min()).to_string_view(),
+              "-0x8000000000000000"sv);
+}
+
+TEST(FormatSpec, Floats)
+{
+    const auto line = fmt::compile<"{0:e} {1:10.2f} {2:<8.3}| {3:+g} {4:010} {5:08}">();
+
+    EXPECT_EQ(line.format<128>(1234.5, -3.14159, 0.5f, 1e-5, -1.5, std::numeric_limits<double>::infinity())
+                  .to_string_view(),
+              "1.234500e+03      -3.14 0.5     | +1e-05 -0000001.5      inf"sv);
+    EXPECT_EQ(fmt::compile<"{0:.64f}">().format<512>(std::numeric_limits<double>::max()).size(), 309 + 1 + 64);
+}
+
+TEST(FormatSpec, Runtime)
+{
+    std::string out;
+    fmt::format_to(std::back_inserter(out), "{0:>5}|{1:<5}|{2:^5}|{3:05.1f}"sv, 12, "ab"sv, 'c', 2.25);
+    EXPECT_EQ(out, "   12|ab   |  c  |002.2"sv);
+
+    EXPECT_THROW(fmt::format_to(std::back_inserter(out), "{0:x}"sv, "ab"sv), std::invalid_argument);
+    EXPECT_THROW(fmt::format_to(std::back_inserter(out), "{0:.2}"sv, 12), std::invalid_argument);
+    EXPECT_THROW(fmt::format_to(std::back_inserter(out), "{0:+}"sv, true), std::invalid_argument);
+    EXPECT_THROW(fmt::format_to(std::back_inserter(out), "{0:#e}"sv, 1.0), std::invalid_argument);
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#include "../../inc/parser_demo"
+
+using namespace std::literals;
+using namespace d1;
+
+namespace
+{
+// A file in the temporary directory, removed with the object.
+class TempFile
+{
+public:
+    TempFile(const std::string& name, std::string_view content)
+        : _path(std::filesystem::temp_directory_path() / ("parser_demo_" + name))
+    {
+        // not `<<`, which is a combinator here
+        std::ofstream(_path, std::ios::binary).write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    ~TempFile()
+    {
+        std::filesystem::remove(_path);
+    }
+
+    const std::filesystem::path& path() const
+    {
+        return _path;
+    }
+
+private:
+    std::filesystem::path _path;
+};
+
+template <typename Parser>
+concept parses_file = requires(const Parser& parser, const std::filesystem::path& path) { ParseFile(parser, path); };
+}  // namespace
+
+TEST(MappedInput, ViewsTheFile)
+{
+    const auto file  = TempFile("views", "hello 42"sv);
+    const auto input = MappedInput(file.path());
+
+    EXPECT_EQ(input.size(), 8);
+    EXPECT_EQ(input.view(), "hello 42"sv);
+
+    const auto result = TakeWhile1(alphabet_set)(input);
+
+    EXPECT_EQ(result.unwrap().first, "hello"sv);
+    EXPECT_EQ(result.unwrap().second.data(), input.data() + 5);
+}
+
+TEST(MappedInput, EmptyFile)
+{
+    const auto file  = TempFile("empty", ""sv);
+    const auto input = MappedInput(file.path());
+
+    EXPECT_EQ(input.size(), 0);
+    EXPECT_TRUE(input.view().empty());
+}
+
+TEST(MappedInput, MissingFile)
+{
+    EXPECT_THROW(MappedInput(std::filesystem::temp_directory_path() / "parser_demo_missing"), std::system_error);
+}
+
+TEST(MappedInput, MoveAndOptions)
+{
+    const auto file = TempFile("move", "abc"sv);
+
+    auto input =
+        MappedInput(file.path(), MapOptions{.access = MapAccess::Random, .will_need = false, .huge_pages = true});
+    auto moved = std::move(input);
+
+    EXPECT_EQ(input.size(), 0);
+    EXPECT_EQ(moved.view(), "abc"sv);
+}
+
+TEST(MappedInput, DiscardBefore)
+{
+    const auto content = std::string(1 << 16, 'x') + "tail";
+    const auto file    = TempFile("discard", content);
+    auto       input   = MappedInput(file.path());
+
+    input.discard_before(input.data() + input.size() - 4);
+
+    // the discarded pages are read back from the file
+    EXPECT_EQ(input.view(), content);
+}
+
+TEST(MappedInput, ParseFile)
+{
+    const auto file   = TempFile("parse", "12345 rest"sv);
+    const auto result = ParseFile(uint32_parser, file.path());
+
+    EXPECT_EQ(result.unwrap().first, 12345u);
+    EXPECT_EQ(result.unwrap().second, 5);
+    EXPECT_TRUE(ParseFile(alphabet_parser, file.path()).is_none());
+}
+
+TEST(MappedInput, ParseFileRejectsViews)
+{
+    // the mapping is gone once `ParseFile` returns, a slice of it would dangle
+    constexpr auto slice_parser = TakeWhile1(alphabet_set);
+    constexpr auto pair_parser  = Combine(uint32_parser, slice_parser, [](auto n, auto word) {
+        return std::make_pair(n, word);
+    });
+
+    static_assert(parses_file<decltype(uint32_parser)>);
+    static_assert(!parses_file<decltype(slice_parser)>);
+    static_assert(!parses_file<decltype(pair_parser)>);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "../../inc/parser_demo"
+
+using namespace std::literals;
+using namespace d1;
+
+namespace
+{
+// stmt := word '=' word | word ':' word | word ';'
+template <typename Word>
+auto StatementParser(const Word& word)
+{
+    return Combine(word << ParseChar('='), word, [](auto lhs, auto rhs) { return lhs.size() + rhs.size(); }) ||
+           Combine(word << ParseChar(':'), word, [](auto lhs, auto rhs) { return lhs.size() * rhs.size(); }) ||
+           Map(word << ParseChar(';'), [](auto lhs) { return lhs.size(); });
+}
+}  // namespace
+
+TEST(Memo, SharedPrefixIsParsedOnce)
+{
+    MemoTable  table;
+    const auto stmt_parser = StatementParser(Memo(table, TakeWhile1(alphabet_set)));
+
+    const auto result = stmt_parser("abcd;"sv);
+
+    EXPECT_EQ(result.unwrap().first, 4);
+    EXPECT_EQ(result.unwrap().second, ""sv);
+    EXPECT_EQ(table.stats().evaluations, 1);
+    EXPECT_EQ(table.stats().hits, 2);
+    EXPECT_EQ(table.stats().rescanned_bytes, 0);
+    EXPECT_EQ(table.stats().saved_bytes, 8);
+}
+
+TEST(Memo, CountRescansWithoutCaching)
+{
+    MemoTable  table(false);
+    const auto stmt_parser = StatementParser(Memo(table, TakeWhile1(alphabet_set)));
+
+    const auto result = stmt_parser("abcd;"sv);
+
+    EXPECT_EQ(result.unwrap().first, 4);
+    EXPECT_EQ(table.stats().evaluations, 3);
+    EXPECT_EQ(table.stats().hits, 0);
+    EXPECT_EQ(table.stats().rescanned_bytes, 8);
+    EXPECT_EQ(table.stats().rescanned_bytes_without_memo(), 8);
+}
+
+TEST(Memo, CachedFailure)
+{
+    MemoTable  table;
+    const auto digit  = Memo(table, ParseOneOfChars(digit_set));
+    const auto parser = (digit >> ParseChar('a')) || (digit >> ParseChar('b'));
+    const auto result = parser("xb"sv);
+
+    EXPECT_TRUE(result.is_none());
+    EXPECT_EQ(table.stats().evaluations, 1);
+    EXPECT_EQ(table.stats().hits, 1);
+}
+
+TEST(Memo, NewInputDropsEntries)
+{
+    MemoTable  table;
+    const auto word = Memo(table, TakeWhile1(alphabet_set));
+
+    const std::string first  = "abc";
+    const std::string second = "xyz";
+
+    EXPECT_EQ(word(first).unwrap().first, "abc"sv);
+    EXPECT_EQ(word(second).unwrap().first, "xyz"sv);
+    EXPECT_EQ(table.stats().hits, 0);
+}
+
+TEST(Memo, BeginDropsEntriesOfReusedBuffer)
+{
+    MemoTable  table;
+    const auto word = Memo(table, TakeWhile1(alphabet_set));
+
+    // a new line read into the same buffer, of the same length
+    std::string buffer = "abc def";
+    table.begin(buffer);
+    EXPECT_EQ(word(buffer).unwrap().first, "abc"sv);
+
+    const auto data = buffer.data();
+    buffer          = "xy1 def";
+    ASSERT_EQ(buffer.data(), data);
+    table.begin(buffer);
+    EXPECT_EQ(word(buffer).unwrap().first, "xy"sv);
+    EXPECT_EQ(table.stats().hits, 0);
+}
+
+TEST(Memo, CutFreesEntriesBehind)
+{
+    MemoTable  table;
+    const auto word  = Memo(table, TakeWhile1(alphabet_set));
+    const auto line  = Cut(table, word << ParseChar(';'));
+    const auto input = "abc;defgh;"sv;
+
+    EXPECT_EQ(word(input).unwrap().first, "abc"sv);
+    EXPECT_EQ(table.size(), 1);
+
+    const auto second = line(input);
+
+    EXPECT_EQ(second.unwrap().first, "abc"sv);
+    EXPECT_EQ(table.size(), 0);
+    EXPECT_EQ(table.stats().hits, 1);
+}
+
+TEST(Memo, CutBoundsTableSize)
+{
+    MemoTable  table;
+    const auto word = Memo(table, TakeWhile1(alphabet_set));
+    const auto stmt = Cut(table, StatementParser(word));
+
+    // the table holds the statement being parsed at most, however many were parsed before it
+    std::string input;
+    for (int i = 0; i < 1000; ++i)
+    {
+        input += "ab=cd;ef:gh;ijk;";
+    }
+    std::size_t peak = 0;
+    for (ParserInput code = input; !code.empty();)
+    {
+        code = stmt(code).unwrap().second;
+        code.remove_prefix(!code.empty() && code.front() == ';' ? 1 : 0);
+        peak = std::max(peak, table.size());
+    }
+
+    EXPECT_LE(peak, 4);
+    EXPECT_GT(table.stats().hits, 0);
+}
+
+TEST(Memo, ClearKeepsStats)
+{
+    MemoTable  table;
+    const auto word  = Memo(table, TakeWhile1(alphabet_set));
+    const auto input = "abc"sv;
+
+    word(input);
+    table.clear();
+    word(input);
+
+    EXPECT_EQ(table.size(), 1);
+    EXPECT_EQ(table.stats().evaluations, 2);
+    EXPECT_EQ(table.stats().hits, 0);
+
+    table.reset_stats();
+
+    EXPECT_EQ(table.stats().evaluations, 0);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../inc/parser_demo"
+
+using namespace std::literals;
+using namespace d1;
+
+namespace
+{
+// record := key '=' int
+const auto record_parser = Combine(TakeWhile1(alphabet_set) << ParseChar('='), int32_parser,
+                                   [](std::string_view key, int value) { return key.size() * 1000 + value; });
+
+// `count` records of growing sizes, with blank lines here and there
+std::string Records(std::size_t count)
+{
+    std::string out;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out += std::string(1 + i % 13, 'k') + "=" + std::to_string(i) + "\n";
+        if (i % 7 == 0)
+        {
+            out += "\n";
+        }
+    }
+    return out;
+}
+
+std::vector<std::size_t> Expected(std::size_t count)
+{
+    std::vector<std::size_t> out;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out.push_back((1 + i % 13) * 1000 + i);
+    }
+    return out;
+}
+}  // namespace
+
+TEST(Parallel, ResultsInOrder)
+{
+    const auto input = Records(2000);
+
+    // chunk boundaries anywhere in the records, with more threads than chunks at times
+    for (const std::size_t chunk_size : {1, 7, 64, 1000, 1 << 20})
+    {
+        for (const std::size_t threads : {1, 2, 4, 16})
+        {
+            const auto options = ParallelOptions{.threads = threads, .chunk_size = chunk_size};
+            const auto result  = ParallelParse(record_parser, input, '\n', options);
+
+            ASSERT_TRUE(result.is_some());
+            EXPECT_EQ(result.unwrap(), Expected(2000));
+        }
+    }
+}
+
+TEST(Parallel, LastRecordWithoutDelimiter)
+{
+    const auto result = ParallelParse(record_parser, "a=1;b=2;cc=3"sv, ';', {.threads = 2, .chunk_size = 3});
+
+    ASSERT_TRUE(result.is_some());
+    EXPECT_EQ(result.unwrap(), (std::vector<std::size_t>{1001, 1002, 2003}));
+    EXPECT_TRUE(ParallelParse(record_parser, ""sv).unwrap().empty());
+}
+
+TEST(Parallel, FailedRecord)
+{
+    auto input = Records(500);
+    input += "k=1 trailing\n" + Records(500);
+
+    EXPECT_TRUE(ParallelParse(record_parser, input, '\n', {.threads = 4, .chunk_size = 100}).is_none());
+    EXPECT_TRUE(ParallelParse(record_parser, "a=1\n=2\n"sv).is_none());
+}
+
+TEST(Parallel, RethrowsOnCaller)
+{
+    const auto throwing_parser = [](ParserInput code) -> ParserOutput<int> {
+        if (code == "boom"sv)
+        {
+            throw std::runtime_error("boom");
+        }
+        return SOME(std::make_pair(0, code.substr(code.size())));
+    };
+
+    EXPECT_THROW(ParallelParse(throwing_parser, "a\nb\nboom\nc\n"sv, '\n', {.threads = 3, .chunk_size = 2}),
+                 std::runtime_error);
+}
@@ -138,4 +138,499 @@ TEST(BasicParserCombinators, CStringWithEscape)
 
     static_assert(result.unwrap().first == "abcde\fg\n\\"sv);
     static_assert(result.unwrap().second == ""sv);
-}
\ No newline at end of file
+}
+
+TEST(BasicParserCombinators, OneOfCharSet)
+{
+    constexpr auto hex_parser = ParseOneOfChars(digit_set | CharSet::range('a', 'f'));
+
+    static_assert(hex_parser("f0"sv).unwrap().first == 'f');
+    static_assert(hex_parser("f0"sv).unwrap().second == "0"sv);
+    static_assert(hex_parser("g0"sv).is_none());
+    static_assert(hex_parser(""sv).is_none());
+}
+
+TEST(BasicParserCombinators, NoneOfChars)
+{
+    constexpr auto not_quote_parser = ParseNoneOfChars("\"\\"sv);
+
+    static_assert(not_quote_parser("a\""sv).unwrap().first == 'a');
+    static_assert(not_quote_parser("\"a"sv).is_none());
+    static_assert(not_quote_parser("\\a"sv).is_none());
+    static_assert(not_quote_parser(""sv).is_none());
+}
+
+TEST(Combinators, TakeWhile)
+{
+    constexpr auto ident_parser = TakeWhile(alphabet_set | digit_set);
+
+    constexpr auto result = ident_parser("abc123 = 4"sv);
+    constexpr auto empty  = ident_parser(" = 4"sv);
+
+    static_assert(result.unwrap().first == "abc123"sv);
+    static_assert(result.unwrap().second == " = 4"sv);
+    static_assert(empty.unwrap().first == ""sv);
+    static_assert(empty.unwrap().second == " = 4"sv);
+}
+
+TEST(Combinators, TakeWhile1)
+{
+    constexpr auto spaces_parser = TakeWhile1(" \t"sv);
+
+    static_assert(spaces_parser(" \t x"sv).unwrap().first == " \t "sv);
+    static_assert(spaces_parser("x"sv).is_none());
+    static_assert(spaces_parser(""sv).is_none());
+}
+
+TEST(Combinators, TakeUntil)
+{
+    constexpr auto line_parser = TakeUntil("\n"sv);
+
+    static_assert(line_parser("first\nsecond"sv).unwrap().first == "first"sv);
+    static_assert(line_parser("first\nsecond"sv).unwrap().second == "\nsecond"sv);
+    static_assert(line_parser("no newline"sv).unwrap().first == "no newline"sv);
+}
+
+TEST(Combinators, TakeWhileRuntime)
+{
+    const auto line   = std::string(1000, 'x') + "\nrest";
+    const auto result = TakeUntil("\n"sv)(line);
+
+    EXPECT_EQ(result.unwrap().first.size(), 1000);
+    EXPECT_EQ(result.unwrap().second, "\nrest"sv);
+    EXPECT_EQ(TakeWhile("x"sv)(std::string_view{}).unwrap().first, ""sv);
+}
+
+TEST(Combinators, InplaceAccumulator)
+{
+    constexpr auto word_parser =
+        Many(alphabet_parser, StaticString<char, 16>(), [](auto& acc, char ch) { acc.push_back(ch); });
+    constexpr auto digits_parser = Exactly(digit_parser, 0, 3, [](int& acc, int dig) { acc = acc * 10 + dig; });
+
+    static_assert(word_parser("hello world"sv).unwrap().first == "hello"sv);
+    static_assert(word_parser("hello world"sv).unwrap().second == " world"sv);
+    static_assert(word_parser(" hello"sv).is_none());
+    static_assert(digits_parser("12345"sv).unwrap().first == 123);
+    static_assert(digits_parser("12345"sv).unwrap().second == "45"sv);
+}
+
+TEST(Combinators, LoweredWithLambdaParser)
+{
+    // parsers which are not lowered still compose with lowered ones
+    constexpr auto sign_parser = [](ParserInput code) -> ParserOutput<char> {
+        return code.empty() || code[0] != '#' ? NONE : SOME(std::make_pair('#', code.substr(1)));
+    };
+    constexpr auto tag_parser = sign_parser >> Many(digit_parser, 0, [](int& acc, int dig) { acc = acc * 10 + dig; });
+
+    static_assert(tag_parser("#42;"sv).unwrap().first == 42);
+    static_assert(tag_parser("#42;"sv).unwrap().second == ";"sv);
+    static_assert(tag_parser("42"sv).is_none());
+}
+
+TEST(Combinators, LoweredWithoutDefaultConstructor)
+{
+    struct Digit
+    {
+        constexpr explicit Digit(int value) : value(value) {}
+
+        int value;
+    };
+
+    constexpr auto digit_parser_ = Map(digit_parser, [](int dig) { return Digit(dig); }) << ParseChar(';');
+    constexpr auto pair_parser   = Combine(digit_parser_, digit_parser_, [](Digit lhs, Digit rhs) {
+        return Digit(lhs.value * 10 + rhs.value);
+    });
+
+    static_assert(pair_parser("4;2;"sv).unwrap().first.value == 42);
+    static_assert(pair_parser("4;2"sv).is_none());
+}
+
+TEST(Combinators, SequenceBacktracks)
+{
+    constexpr auto ab_parser = (ParseChar('a') >> ParseChar('b')) || ParseString("ac"sv) >> ParseChar('c');
+
+    static_assert(ab_parser("ab"sv).unwrap().first == 'b');
+    static_assert(ab_parser("acc"sv).unwrap().first == 'c');
+    static_assert(ab_parser("ad"sv).is_none());
+}
+
+namespace
+{
+template <typename Lhs, typename Rhs>
+concept selects = requires(Lhs lhs, Rhs rhs) {
+    lhs << rhs;
+    lhs >> rhs;
+};
+}  // namespace
+
+TEST(Combinators, SelectOnlyParsers)
+{
+    using d1::core::parser::__impl::Discard;
+    using d1::core::parser::__impl::Slot;
+
+    // the operators are found by ADL on the types of `d1::core::parser::__impl`, which are not all parsers
+    static_assert(selects<decltype(ParseChar('a')), decltype(ParseChar('b'))>);
+    static_assert(!selects<Discard, int>);
+    static_assert(!selects<Slot<int>, Discard>);
+    static_assert(!selects<decltype(ParseChar('a')), int>);
+}
+
+TEST(Combinators, FirstSet)
+{
+    using d1::core::parser::__impl::FirstOf;
+
+    constexpr auto sign_parser   = ParseOneOfChars("+-"sv);
+    constexpr auto number_parser = Try(sign_parser, '+') >> digit_parser;
+    constexpr auto words_parser  = Many(alphabet_parser, 0, [](int acc, char) { return acc + 1; });
+
+    static_assert(FirstOf(number_parser).chars == (CharSet("+-") | digit_set));
+    static_assert(!FirstOf(number_parser).nullable);
+    static_assert(FirstOf(words_parser).chars == alphabet_set);
+    static_assert(!FirstOf(words_parser).nullable);
+    static_assert(FirstOf(TakeWhile(digit_set)).nullable);
+    static_assert(FirstOf(ParseString(""sv)).nullable);
+    static_assert(FirstOf(ParseString("if"sv)).chars == CharSet("i"));
+}
+
+TEST(Combinators, Choice)
+{
+    constexpr auto keyword_parser =
+        Choice(ParseString("if"sv), ParseString("else"sv), ParseString("while"sv), ParseString("return"sv));
+
+    static_assert(keyword_parser("else {"sv).unwrap().first == "else"sv);
+    static_assert(keyword_parser("return;"sv).unwrap().second == ";"sv);
+    static_assert(keyword_parser("for"sv).is_none());
+    static_assert(keyword_parser(""sv).is_none());
+}
+
+TEST(Combinators, ChoiceIsOrdered)
+{
+    // both branches may start with 'i', the first one which succeeds wins, as with `||`
+    constexpr auto prefix_parser = Choice(ParseString("in"sv), ParseString("int"sv), TakeWhile1(alphabet_set));
+
+    static_assert(prefix_parser("int"sv).unwrap().first == "in"sv);
+    static_assert(prefix_parser("ix"sv).unwrap().first == "ix"sv);
+    static_assert(prefix_parser("x"sv).unwrap().first == "x"sv);
+}
+
+TEST(Combinators, ChoiceNullableAndOpaqueBranches)
+{
+    const auto opaque_parser = [](ParserInput code) -> ParserOutput<std::string_view> {
+        if (code.starts_with("#"sv))
+        {
+            return SOME(std::make_pair(code.substr(0, 1), code.substr(1)));
+        }
+        return NONE;
+    };
+    const auto parser = Choice(ParseString("a"sv), opaque_parser, TakeWhile(digit_set));
+
+    EXPECT_EQ(parser("a1"sv).unwrap().first, "a"sv);
+    EXPECT_EQ(parser("#1"sv).unwrap().first, "#"sv);
+    EXPECT_EQ(parser("12x"sv).unwrap().first, "12"sv);
+    // only the nullable branch can match the rest, or the end of input
+    EXPECT_EQ(parser("x"sv).unwrap().first, ""sv);
+    EXPECT_EQ(parser(""sv).unwrap().second, ""sv);
+}
+
+TEST(AnyParser, StoresInPlace)
+{
+    AnyParser<std::string_view> parser = TakeWhile1(alphabet_set);
+
+    ASSERT_TRUE(parser);
+    EXPECT_TRUE(parser.is_inline());
+    EXPECT_EQ(parser("abc1"sv).unwrap().first, "abc"sv);
+    EXPECT_TRUE(parser("1"sv).is_none());
+
+    // too large to fit, so it is allocated
+    AnyParser<std::string_view, 16> small = TakeWhile1(alphabet_set);
+
+    EXPECT_FALSE(small.is_inline());
+    EXPECT_EQ(small("abc1"sv).unwrap().second, "1"sv);
+}
+
+TEST(AnyParser, CopyAndMove)
+{
+    AnyParser<char>                 original = ParseChar('a');
+    AnyParser<char>                 copied   = original;
+    AnyParser<std::string_view, 16> heap     = TakeWhile1(alphabet_set);
+    AnyParser<std::string_view, 16> stolen = std::move(heap);
+
+    EXPECT_EQ(copied("a"sv).unwrap().first, 'a');
+    EXPECT_EQ(original("a"sv).unwrap().first, 'a');
+    EXPECT_FALSE(heap);
+    EXPECT_EQ(stolen("ab"sv).unwrap().first, "ab"sv);
+
+    copied = ParseChar('b');
+    EXPECT_EQ(copied("b"sv).unwrap().first, 'b');
+    EXPECT_TRUE(copied("a"sv).is_none());
+}
+
+TEST(AnyParser, Empty)
+{
+    AnyParser<char> parser;
+
+    EXPECT_FALSE(parser);
+    EXPECT_THROW(parser("a"sv), std::bad_function_call);
+}
+
+TEST(AnyParser, RecursiveGrammar)
+{
+    // nested := '(' nested ')' | 'x', the result is the depth
+    AnyParser<int> nested;
+    nested = Map(ParseChar('(') >> ParserRef<int>(nested) << ParseChar(')'), [](int depth) { return depth + 1; }) ||
+             Map(ParseChar('x'), [](char) { return 0; });
+
+    EXPECT_TRUE(nested.is_inline());
+    EXPECT_EQ(nested("x"sv).unwrap().first, 0);
+    EXPECT_EQ(nested("(((x)))!"sv).unwrap().first, 3);
+    EXPECT_EQ(nested("(((x)))!"sv).unwrap().second, "!"sv);
+    EXPECT_TRUE(nested("((x)"sv).is_none());
+}
+
+TEST(AnyParser, ParserIsAnyParser)
+{
+    static_assert(std::same_as<Parser<int>, AnyParser<int>>);
+
+    const Parser<int> lambda_parser = [](ParserInput code) -> ParserOutput<int> {
+        return code.empty() ? NONE : SOME(std::make_pair(1, code.substr(1)));
+    };
+
+    EXPECT_EQ(lambda_parser("a"sv).unwrap().first, 1);
+    const auto count_parser = Many(ParserRef<int>(lambda_parser), 0, [](int acc, int one) { return acc + one; });
+
+    EXPECT_EQ(count_parser("abc"sv).unwrap().first, 3);
+}
+
+TEST(AnyParser, ParserRef)
+{
+    const auto                  digits_parser = TakeWhile1(digit_set);
+    ParserRef<std::string_view> copied        = ParserRef<std::string_view>(digits_parser);
+
+    EXPECT_EQ(copied("12a"sv).unwrap().first, "12"sv);
+
+    // a reference to an `AnyParser` follows its reassignment
+    AnyParser<std::string_view> rule = TakeWhile1(alphabet_set);
+    const auto                  ref  = ParserRef<std::string_view>(rule);
+
+    EXPECT_EQ(ref("ab1"sv).unwrap().first, "ab"sv);
+    rule = digits_parser;
+    EXPECT_EQ(ref("12a"sv).unwrap().first, "12"sv);
+}
+
+TEST(BasicParserCombinators, IntegerStopsBeforeOverflow)
+{
+    // a prefix above `INT32_MAX / 10` takes no more digits, whatever the next one is
+    static_assert(int32_parser("2147483650"sv).unwrap().first == 214748365);
+    static_assert(int32_parser("2147483650"sv).unwrap().second == "0"sv);
+    static_assert(uint32_parser("4294967300"sv).unwrap().first == 429496730);
+    static_assert(uint64_parser("18446744073709551620"sv).unwrap().first == 1844674407370955162u);
+    static_assert(int64_parser("-9223372036854775810"sv).unwrap().first == -922337203685477581);
+    // leading zeros never overflow
+    static_assert(uint32_parser("000004294967295"sv).unwrap().first == 4294967295u);
+    static_assert(uint32_parser("000004294967295"sv).unwrap().second == ""sv);
+    static_assert(uint32_parser("0x"sv).unwrap().first == 0);
+    static_assert(uint32_parser("x"sv).is_none());
+}
+
+TEST(BasicParserCombinators, DecimalWithSingleDigitMax)
+{
+    constexpr auto digit_parser = ParseDecimal<std::uint8_t, 5>();
+
+    static_assert(digit_parser("3x"sv).unwrap().first == 3);
+    static_assert(digit_parser("3x"sv).unwrap().second == "x"sv);
+    static_assert(digit_parser("36"sv).unwrap().second == "6"sv);
+    static_assert(digit_parser("7"sv).is_none());
+    static_assert(digit_parser("7x"sv).is_none());
+    static_assert(digit_parser("007"sv).unwrap().first == 0);
+    static_assert(digit_parser("007"sv).unwrap().second == "7"sv);
+}
+
+TEST(BasicParserCombinators, IntegerRuntime)
+{
+    // the same cases through the runtime path
+    const auto input = [](std::string_view str) { return std::string(str); };
+
+    EXPECT_EQ(int32_parser(input("2147483647")).unwrap().first, 2147483647);
+    EXPECT_EQ(int32_parser(input("2147483648")).unwrap().first, 214748364);
+    EXPECT_EQ(int32_parser(input("-2147483648")).unwrap().first, -2147483648);
+    EXPECT_EQ(int32_parser(input("-2147483649")).unwrap().first, -214748364);
+    EXPECT_EQ(int32_parser(input("2147483650")).unwrap().first, 214748365);
+    EXPECT_EQ(uint32_parser(input("4294967295")).unwrap().first, 4294967295u);
+    EXPECT_EQ(uint32_parser(input("42949672951")).unwrap().first, 4294967295u);
+    EXPECT_EQ(uint64_parser(input("18446744073709551615")).unwrap().first, 18446744073709551615u);
+    EXPECT_EQ(uint64_parser(input("18446744073709551616")).unwrap().first, 1844674407370955161u);
+    EXPECT_EQ(int64_parser(input("-9223372036854775808")).unwrap().first, std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(uint32_parser(input("000004294967295")).unwrap().first, 4294967295u);
+    EXPECT_EQ(uint32_parser(input("12345678 9")).unwrap().first, 12345678u);
+    EXPECT_TRUE(uint32_parser(input("-1")).is_none());
+
+    for (std::uint64_t value = 1; value < 10000000000000000000u; value = value * 7 + 3)
+    {
+        const auto str = std::to_string(value) + "!";
+        EXPECT_EQ(uint64_parser(str).unwrap().first, value);
+        EXPECT_EQ(uint64_parser(str).unwrap().second, "!"sv);
+    }
+}
+
+TEST(Combinators, Recognize)
+{
+    constexpr auto assign_parser = Recognize(TakeWhile1(alphabet_set) >> ParseChar('=') >> int32_parser);
+
+    static_assert(assign_parser("abc=-42;"sv).unwrap().first == "abc=-42"sv);
+    static_assert(assign_parser("abc=-42;"sv).unwrap().second == ";"sv);
+    static_assert(assign_parser("abc=;"sv).is_none());
+    static_assert(Recognize(c_str_parser<4>)(R"(ab\ncdefg")"sv).unwrap().first == R"(ab\ncdefg)"sv);
+    static_assert(Recognize(Try(ParseChar('-'), '+'))("1"sv).unwrap().first == ""sv);
+}
+
+TEST(Combinators, RecognizeBuildsNoResult)
+{
+    int        calls   = 0;
+    const auto counted = Map(ParseOneOfChars(digit_set), [&calls](char ch) {
+        calls += 1;
+        return ch;
+    });
+    const auto parser  = Many(counted, 0, [](int acc, char) { return acc + 1; }) << ParseChar(';');
+
+    EXPECT_EQ(parser("123;"sv).unwrap().first, 3);
+    EXPECT_EQ(calls, 3);
+
+    calls = 0;
+    EXPECT_EQ(Recognize(parser)("123;x"sv).unwrap().first, "123;"sv);
+    EXPECT_EQ(calls, 0);
+
+    // the dropped side of `<<` and `>>` is only recognized
+    EXPECT_EQ((counted >> ParseChar('a'))("1a"sv).unwrap().first, 'a');
+    EXPECT_EQ(calls, 0);
+
+    // unless a predicator needs the values
+    const auto bounded =
+        While(counted, 0, [](int acc, char) { return acc + 1; }, [](int acc, char) { return acc < 2; });
+    EXPECT_EQ(Recognize(bounded)("1234"sv).unwrap().first, "12"sv);
+    EXPECT_EQ(calls, 3);
+}
+
+namespace
+{
+// `ParseString<Str>()` against the runtime `ParseString`: on the string itself, on every truncation of it and with
+// every char changed
+template <core::basic_parser_combinator::__impl::Literal Str>
+void ExpectSameAsRuntime()
+{
+    constexpr auto literal_parser = ParseString<Str>();
+    const auto     str            = std::string(Str.view());
+    const auto     runtime_parser = ParseString(str);
+
+    const auto expect_same = [&](const std::string& input) {
+        const auto expected = runtime_parser(input);
+        const auto result   = literal_parser(input);
+
+        ASSERT_EQ(result.is_some(), expected.is_some());
+        if (result.is_some())
+        {
+            EXPECT_EQ(result.unwrap().first, str);
+            EXPECT_EQ(result.unwrap().second.size(), expected.unwrap().second.size());
+        }
+    };
+
+    expect_same(str);
+    expect_same(str + "tail of the input");
+    for (std::size_t i = 0; i < str.size(); ++i)
+    {
+        expect_same(str.substr(0, i));
+        auto changed = str + "tail of the input";
+        changed[i] ^= 0x20;
+        expect_same(changed);
+    }
+}
+}  // namespace
+
+TEST(BasicParserCombinators, LiteralString)
+{
+    constexpr auto get_parser = ParseString<"GET">();
+
+    static_assert(get_parser("GET /index.html"sv).unwrap().first == "GET"sv);
+    static_assert(get_parser("GET /index.html"sv).unwrap().second == " /index.html"sv);
+    static_assert(get_parser("GE"sv).is_none());
+    static_assert(ParseString<"">()("x"sv).unwrap().second == "x"sv);
+    static_assert(Choice(ParseString<"GET">(), ParseString<"POST">())("POST"sv).unwrap().first == "POST"sv);
+
+    ExpectSameAsRuntime<"">();
+    ExpectSameAsRuntime<"a">();
+    ExpectSameAsRuntime<"GET">();
+    ExpectSameAsRuntime<"OPTIONS">();
+    ExpectSameAsRuntime<"CONNECT ">();
+    ExpectSameAsRuntime<"Content-Type">();
+    ExpectSameAsRuntime<"Accept-Encoding:">();
+    ExpectSameAsRuntime<"Access-Control-Allow-Origin">();
+    ExpectSameAsRuntime<"Access-Control-Allow-Credentials">();
+    ExpectSameAsRuntime<"Access-Control-Request-Private-Network">();
+}
+
+TEST(BasicParserCombinators, OneOfStrings)
+{
+    constexpr auto keyword_parser = ParseOneOfStrings<"in", "int", "if", "else", "elif", "integer">();
+
+    static_assert(keyword_parser("int x"sv).unwrap().first == "int"sv);
+    static_assert(keyword_parser("int x"sv).unwrap().second == " x"sv);
+    static_assert(keyword_parser("inx"sv).unwrap().first == "in"sv);
+    static_assert(keyword_parser("integers"sv).unwrap().first == "integer"sv);
+    static_assert(keyword_parser("intege"sv).unwrap().first == "int"sv);
+    static_assert(keyword_parser("el"sv).is_none());
+    static_assert(keyword_parser("x"sv).is_none());
+    static_assert(keyword_parser(""sv).is_none());
+
+    constexpr auto index_parser = ParseIndexOfStrings<"in", "int", "if", "else", "elif", "in">();
+
+    static_assert(index_parser("elif"sv).unwrap().first == 4);
+    static_assert(index_parser("in"sv).unwrap().first == 0);
+
+    // the empty string matches when nothing longer does
+    static_assert(ParseOneOfStrings<"", "a">()("b"sv).unwrap().second == "b"sv);
+    static_assert(ParseOneOfStrings<"", "a">()("ab"sv).unwrap().second == "b"sv);
+
+    using core::parser::__impl::FirstOf;
+
+    static_assert(FirstOf(keyword_parser).chars == CharSet("ie"));
+    static_assert(!FirstOf(keyword_parser).nullable);
+    static_assert(FirstOf(ParseOneOfStrings<"", "a">()).nullable);
+}
+
+TEST(BasicParserCombinators, OneOfStringsRuntime)
+{
+    constexpr std::string_view keywords[] = {"in", "int", "if", "else", "elif", "integer"};
+
+    const auto keyword_parser = ParseOneOfStrings<"in", "int", "if", "else", "elif", "integer">();
+
+    // the longest keyword which the input starts with
+    const auto expect_longest = [&](const std::string& input) {
+        std::string_view longest;
+        bool             found = false;
+        for (const auto keyword : keywords)
+        {
+            if (input.starts_with(keyword) && (!found || keyword.size() > longest.size()))
+            {
+                longest = keyword;
+                found   = true;
+            }
+        }
+
+        const auto result = keyword_parser(input);
+        ASSERT_EQ(result.is_some(), found) << input;
+        if (found)
+        {
+            EXPECT_EQ(result.unwrap().first, longest);
+            EXPECT_EQ(result.unwrap().second, std::string_view(input).substr(longest.size()));
+        }
+    };
+
+    for (const auto keyword : keywords)
+    {
+        const auto str = std::string(keyword) + " tail";
+        for (std::size_t i = 0; i <= str.size(); ++i)
+        {
+            expect_longest(str.substr(0, i));
+        }
+    }
+    expect_longest("\xFF");
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../../inc/parser_demo"
+
+using namespace std::literals;
+using namespace d1;
+
+namespace
+{
+// item := spaces (word | int ';' | '"' c_str '"')
+const auto item_parser = TakeWhile(" \n"sv) >> Choice(Map(TakeWhile1(alphabet_set), [](auto word) {
+                                                          return std::string(word);
+                                                      }),
+                                                      Map(int32_parser << ParseChar(';'), [](int value) {
+                                                          return std::to_string(value);
+                                                      }),
+                                                      Map(ParseChar('"') >> ParseString("quoted"sv) << ParseChar('"'),
+                                                          [](auto str) { return std::string(str); }));
+
+constexpr auto input = R"(alpha -12; beta "quoted" 2147483647; gamma
+delta 7;epsilon)"sv;
+
+const std::vector<std::string> expected = {"alpha", "-12", "beta", "quoted", "2147483647", "gamma", "delta", "7",
+                                           "epsilon"};
+
+// feed `code` in chunks of `size` bytes
+template <typename Parser>
+std::vector<std::string> ParseInChunks(StreamParser<Parser>& stream, std::string_view code, std::size_t size)
+{
+    std::vector<std::string> items;
+    const auto               sink = [&items](std::string item) { items.push_back(std::move(item)); };
+    for (std::size_t pos = 0; pos < code.size(); pos += size)
+    {
+        EXPECT_EQ(stream.feed(code.substr(pos, size), sink), StreamStatus::Ready);
+    }
+    EXPECT_EQ(stream.finish(sink), StreamStatus::Ready);
+    return items;
+}
+}  // namespace
+
+TEST(Stream, SameItemsForAnyChunkSize)
+{
+    for (std::size_t size = 1; size <= input.size(); ++size)
+    {
+        auto stream = StreamParser(item_parser);
+
+        EXPECT_EQ(ParseInChunks(stream, input, size), expected);
+        EXPECT_EQ(stream.consumed(), input.size());
+        EXPECT_TRUE(stream.pending().empty());
+    }
+}
+
+TEST(Stream, SplitAtEveryPosition)
+{
+    for (std::size_t split = 0; split <= input.size(); ++split)
+    {
+        auto                     stream = StreamParser(item_parser);
+        std::vector<std::string> items;
+        const auto               sink = [&items](std::string item) { items.push_back(std::move(item)); };
+
+        EXPECT_EQ(stream.feed(input.substr(0, split), sink), StreamStatus::Ready);
+        EXPECT_EQ(stream.feed(input.substr(split), sink), StreamStatus::Ready);
+        EXPECT_EQ(stream.finish(sink), StreamStatus::Ready);
+        EXPECT_EQ(items, expected);
+    }
+}
+
+TEST(Stream, KeepsOnlyThePartialItem)
+{
+    auto                     stream = StreamParser(item_parser);
+    std::vector<std::string> items;
+    const auto               sink = [&items](std::string item) { items.push_back(std::move(item)); };
+
+    EXPECT_EQ(stream.feed("one two th"sv, sink), StreamStatus::Ready);
+    EXPECT_EQ(items, (std::vector<std::string>{"one", "two"}));
+    EXPECT_EQ(stream.pending(), " th"sv);
+
+    // a word may go on in the next chunk, so it is not final until a delimiter or the end
+    EXPECT_EQ(stream.feed("ree"sv, sink), StreamStatus::Ready);
+    EXPECT_EQ(stream.pending(), " three"sv);
+    EXPECT_EQ(stream.finish(sink), StreamStatus::Ready);
+    EXPECT_EQ(items.back(), "three"sv);
+}
+
+TEST(Stream, Error)
+{
+    auto       stream = StreamParser(item_parser);
+    const auto sink   = [](std::string) {};
+
+    EXPECT_EQ(stream.feed("one 12 two"sv, sink), StreamStatus::Error);
+    EXPECT_EQ(stream.consumed(), 3);
+    // sticky until reset
+    EXPECT_EQ(stream.feed("three"sv, sink), StreamStatus::Error);
+
+    stream.reset();
+    EXPECT_EQ(stream.feed("four"sv, sink), StreamStatus::Ready);
+    // a partial item at the end of the stream
+    EXPECT_EQ(stream.feed(" 12"sv, sink), StreamStatus::Ready);
+    EXPECT_EQ(stream.finish(sink), StreamStatus::Error);
+}
+
+TEST(Stream, Overflow)
+{
+    auto       stream = StreamParser(item_parser, 8);
+    const auto sink   = [](std::string) {};
+
+    EXPECT_EQ(stream.feed("short long"sv, sink), StreamStatus::Ready);
+    EXPECT_EQ(stream.feed("er"sv, sink), StreamStatus::Ready);
+    EXPECT_EQ(stream.feed("wordthanthebuffer"sv, sink), StreamStatus::Overflow);
+}
+
+TEST(Stream, MemoizedEndOfInput)
+{
+    // a cached result which hit the end still tells the stream to wait
+    MemoTable  table;
+    const auto word   = Memo(table, TakeWhile1(alphabet_set));
+    const auto parser = TakeWhile(" "sv) >> ((word << ParseChar('=')) || (word << ParseChar(';')));
+
+    auto                          stream = StreamParser(parser);
+    std::vector<std::string_view> items;
+    const auto                    sink = [&items](std::string_view item) { items.push_back(item); };
+
+    EXPECT_EQ(stream.feed("ab= cd; ef"sv, sink), StreamStatus::Ready);
+    EXPECT_EQ(items.size(), 2);
+    EXPECT_EQ(stream.pending(), " ef"sv);
+    EXPECT_EQ(stream.feed("g;"sv, sink), StreamStatus::Ready);
+    EXPECT_EQ(items.size(), 3);
+    EXPECT_TRUE(stream.pending().empty());
+}
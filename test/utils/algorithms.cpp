@@ -69,4 +69,86 @@ TEST(ConstexprCopy, StaticString)
     d1::copy(s2.begin(), s2.end(), d1::back_insert_iterator(s1));
 
     EXPECT_EQ(s1, "hello, world"sv);
-}
\ No newline at end of file
+}
+
+// the runtime fast paths against the constexpr loops
+TEST(RuntimeAlgorithms, Find)
+{
+    constexpr auto text = "the quick brown fox jumps over the lazy dog"sv;
+
+    static_assert(d1::find(text.begin(), text.end(), 'q') == text.begin() + 4);
+
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        EXPECT_EQ(d1::find(text.begin(), text.end(), text[i]), std::find(text.begin(), text.end(), text[i]));
+    }
+    EXPECT_EQ(d1::find(text.begin(), text.end(), '!'), text.end());
+    EXPECT_EQ(d1::find(text.begin(), text.begin(), 't'), text.begin());
+
+    // values out of the range of the elements match nothing
+    EXPECT_EQ(d1::find(text.begin(), text.end(), 't' + 256), text.end());
+
+    const std::array<unsigned char, 3> bytes{0x00, 0xFF, 0x7F};
+    EXPECT_EQ(d1::find(bytes.begin(), bytes.end(), -1), bytes.end());
+    EXPECT_EQ(d1::find(bytes.begin(), bytes.end(), 0xFF), bytes.begin() + 1);
+}
+
+TEST(RuntimeAlgorithms, MismatchAndEqual)
+{
+    const auto text = std::string("the quick brown fox jumps over the lazy dog");
+
+    static_assert(d1::mismatch("abcd"sv.begin(), "abcd"sv.end(), "abxd"sv.begin(), "abxd"sv.end()).first ==
+                  "abcd"sv.begin() + 2);
+    static_assert(d1::equal("abcd"sv.begin(), "abcd"sv.end(), "abcd"sv.begin(), "abcd"sv.end()));
+
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        auto changed = text;
+        changed[i] ^= 0x20;
+
+        const auto [it1, it2] = d1::mismatch(text.begin(), text.end(), changed.begin(), changed.end());
+        EXPECT_EQ(it1 - text.begin(), i);
+        EXPECT_EQ(it2 - changed.begin(), i);
+        EXPECT_FALSE(d1::equal(text.begin(), text.end(), changed.begin(), changed.end()));
+
+        // stops at the end of the shorter range
+        EXPECT_EQ(d1::mismatch(text.begin(), text.end(), text.begin(), text.begin() + i).first, text.begin() + i);
+        EXPECT_FALSE(d1::equal(text.begin(), text.end(), text.begin(), text.begin() + i));
+    }
+    EXPECT_TRUE(d1::equal(text.begin(), text.end(), text.begin(), text.end()));
+
+    const std::array<int, 4> ints1{1, 2, 3, 4};
+    const std::array<int, 4> ints2{1, 2, 0x103, 4};
+    EXPECT_EQ(d1::mismatch(ints1.begin(), ints1.end(), ints2.begin(), ints2.end()).first, ints1.begin() + 2);
+}
+
+TEST(RuntimeAlgorithms, CopyMoveFill)
+{
+    constexpr auto text = "hello, world"sv;
+
+    std::array<char, 16> buffer{};
+    EXPECT_EQ(d1::copy(text.begin(), text.end(), buffer.begin()), buffer.begin() + text.size());
+    EXPECT_EQ(std::string_view(buffer.data(), text.size()), text);
+
+    // overlapping ranges
+    d1::copy(buffer.begin() + 7, buffer.begin() + 12, buffer.begin());
+    EXPECT_EQ(std::string_view(buffer.data(), text.size()), "world, world"sv);
+
+    std::array<int, 4> ints{};
+    const int          src[] = {1, 2, 3};
+    EXPECT_EQ(d1::move_n(std::begin(src), std::end(src), ints.begin(), 2), ints.begin() + 2);
+    EXPECT_EQ(ints, (std::array<int, 4>{1, 2, 0, 0}));
+    EXPECT_EQ(d1::copy_n(std::begin(src), std::end(src), ints.begin(), 8), ints.begin() + 3);
+    EXPECT_EQ(d1::move(std::begin(src), std::end(src), ints.begin() + 1), ints.end());
+    EXPECT_EQ(ints, (std::array<int, 4>{1, 1, 2, 3}));
+
+    d1::fill(buffer.begin(), buffer.end(), 'x');
+    d1::fill_n(buffer.begin(), buffer.end(), 'y', 3);
+    EXPECT_EQ(std::string_view(buffer.data(), buffer.size()), "yyyxxxxxxxxxxxxx"sv);
+
+    // non-trivial elements still take the loops
+    std::array<std::string, 2> strings{};
+    const std::string          words[] = {"hello", "world"};
+    d1::copy(std::begin(words), std::end(words), strings.begin());
+    EXPECT_EQ(strings[1], "world");
+}
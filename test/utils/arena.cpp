@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "../../inc/parser_demo"
+
+using namespace d1;
+using namespace std::literals;
+
+TEST(Arena, AllocateAndRewind)
+{
+    Arena arena(64);
+
+    const auto mark  = arena.mark();
+    auto       first = static_cast<char*>(arena.allocate(16, 1));
+    auto       large = static_cast<char*>(arena.allocate(1000, 8));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large) % 8, 0);
+    EXPECT_GE(arena.capacity(), 1064);
+
+    // the latest allocation grows in place, the others do not
+    EXPECT_TRUE(arena.extend(large, 1000, 1010));
+    EXPECT_FALSE(arena.extend(first, 16, 32));
+
+    // rewinding keeps the blocks, which are then reused
+    const auto capacity = arena.capacity();
+    arena.rewind(mark);
+    EXPECT_EQ(arena.allocate(16, 1), first);
+    arena.allocate(1000, 8);
+    EXPECT_EQ(arena.capacity(), capacity);
+}
+
+TEST(Arena, OverAligned)
+{
+    struct alignas(64) Line
+    {
+        char bytes[64];
+    };
+
+    Arena arena(256);
+
+    // the address is aligned, not only the offset in the block, which is aligned on `max_align_t` at most
+    arena.allocate(8, 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arena.allocate(64, 64)) % 64, 0);
+    arena.allocate(8, 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arena.allocate(512, 256)) % 256, 0);
+
+    ArenaScope        scope(arena);
+    ArenaVector<Line> lines;
+    for (int i = 0; i < 10; ++i)
+    {
+        lines.push_back({});
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(lines.data()) % alignof(Line), 0);
+    }
+}
+
+TEST(Arena, ScopeIsRequired)
+{
+    ArenaVector<int> vec;
+
+    EXPECT_THROW(vec.push_back(1), std::logic_error);
+}
+
+TEST(Arena, NestedScopes)
+{
+    Arena outer_arena;
+    Arena inner_arena;
+
+    ArenaScope outer(outer_arena);
+    EXPECT_EQ(&CurrentArena(), &outer_arena);
+    {
+        ArenaScope inner(inner_arena);
+        EXPECT_EQ(&CurrentArena(), &inner_arena);
+    }
+    EXPECT_EQ(&CurrentArena(), &outer_arena);
+}
+
+TEST(ArenaVector, Grows)
+{
+    Arena      arena(256);
+    ArenaScope scope(arena);
+
+    ArenaVector<int> vec;
+    for (int i = 0; i < 10000; ++i)
+    {
+        vec.push_back(i);
+    }
+    ASSERT_EQ(vec.size(), 10000);
+    for (int i = 0; i < 10000; ++i)
+    {
+        ASSERT_EQ(vec[i], i);
+    }
+
+    // a copy has its own buffer
+    auto copy = vec;
+    copy[0]   = -1;
+    EXPECT_EQ(vec[0], 0);
+    EXPECT_EQ(copy.size(), vec.size());
+
+    // two vectors filled in turn
+    ArenaString<char> str1;
+    ArenaString<char> str2;
+    for (int i = 0; i < 1000; ++i)
+    {
+        str1.push_back('a');
+        str2.push_back('b');
+    }
+    EXPECT_EQ(str1, std::string(1000, 'a'));
+    EXPECT_EQ(str2, std::string(1000, 'b'));
+
+    str1.clear();
+    str1.append("hello, "sv);
+    calgo::copy(str2.begin(), str2.end(), back_insert_iterator(str1));
+    EXPECT_EQ(str1, "hello, " + std::string(1000, 'b'));
+}
+
+TEST(ArenaVector, CStringWithoutLimit)
+{
+    const auto content = std::string(100000, 'x') + "\\n";
+    const auto code    = content + "\"";
+
+    Arena arena;
+    {
+        ArenaScope scope(arena);
+
+        const auto result = ParseArenaCString()(code);
+        ASSERT_TRUE(result.is_some());
+        EXPECT_EQ(result.unwrap().first.size(), 100001);
+        EXPECT_EQ(result.unwrap().first.to_string_view(), std::string(100000, 'x') + "\n");
+        EXPECT_EQ(result.unwrap().second, "\""sv);
+    }
+
+    // the next parse reuses the memory
+    const auto capacity = arena.capacity();
+    {
+        ArenaScope scope(arena);
+        EXPECT_TRUE(ParseArenaCString()(code).is_some());
+    }
+    EXPECT_EQ(arena.capacity(), capacity);
+}
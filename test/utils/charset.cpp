@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "../../inc/parser_demo"
+
+using namespace d1;
+using namespace std::literals;
+
+TEST(CharSet, Empty)
+{
+    constexpr CharSet set;
+
+    static_assert(set.empty());
+    static_assert(set.size() == 0);
+    static_assert(!set.contains('\0'));
+}
+
+TEST(CharSet, FromString)
+{
+    constexpr CharSet set("abc"sv);
+
+    static_assert(set.size() == 3);
+    static_assert(set.contains('a') && set.contains('b') && set.contains('c'));
+    static_assert(!set.contains('d'));
+}
+
+TEST(CharSet, Range)
+{
+    constexpr auto digits = CharSet::range('0', '9');
+
+    static_assert(digits.size() == 10);
+    static_assert(digits == CharSet("0123456789"sv));
+    static_assert(CharSet::range('\x80', '\xFF').size() == 128);
+}
+
+TEST(CharSet, HighBytes)
+{
+    constexpr CharSet set("\xFF\x80"sv);
+
+    static_assert(set.contains('\xFF') && set.contains('\x80'));
+    static_assert(!set.contains('\x7F'));
+}
+
+TEST(CharSet, SetOperations)
+{
+    constexpr auto lower = CharSet::range('a', 'z');
+    constexpr auto upper = CharSet::range('A', 'Z');
+
+    static_assert((lower | upper).size() == 52);
+    static_assert((lower & upper).empty());
+    static_assert((~lower).size() == 256 - 26);
+    static_assert(((lower | upper) - upper) == lower);
+    static_assert(CharSet::all().size() == 256);
+}
+
+TEST(CharSetScanner, CompileTimeSpan)
+{
+    constexpr auto scanner = CharSetScanner(CharSet::range('a', 'z'));
+    constexpr auto text    = "hello, world"sv;
+
+    static_assert(scanner.span(text.data(), text.data() + text.size()) == text.data() + 5);
+    static_assert(scanner.span(text.data() + 5, text.data() + text.size()) == text.data() + 5);
+}
+
+TEST(CharSetScanner, RuntimeSpanMatchesScalar)
+{
+    // every byte value, at every offset of a buffer longer than one AVX2 block
+    const auto set     = CharSet("\x01\x7F\x80\xFF azAZ09"sv) | CharSet::range('\xA0', '\xAF');
+    const auto scanner = CharSetScanner(set);
+
+    for (unsigned byte = 0; byte < 256; ++byte)
+    {
+        for (std::size_t pos = 0; pos < 80; ++pos)
+        {
+            std::string text(80, 'a');
+            text[pos] = static_cast<char>(byte);
+
+            const auto expected = set.contains(static_cast<char>(byte)) ? text.size() : pos;
+            const auto found    = scanner.span(text.data(), text.data() + text.size()) - text.data();
+
+            ASSERT_EQ(found, expected);
+        }
+    }
+}
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 
 #include "../../inc/parser_demo"
 
 using namespace d1;
+using namespace std::literals;
 
 TEST(StaticVector, Construct)
 {
@@ -103,3 +106,135 @@ TEST(StaticVector, OperatorNotEqual)
     static_assert(cvec1 != cvec2);
     EXPECT_NE(cvec1, cvec2);
 }
+
+namespace
+{
+struct NotDefaultConstructible
+{
+    constexpr explicit NotDefaultConstructible(int value) : value(value) {}
+
+    int value;
+};
+
+// counts its live instances
+struct Counted
+{
+    static inline int alive = 0;
+
+    Counted()
+    {
+        ++alive;
+    }
+    Counted(const Counted&)
+    {
+        ++alive;
+    }
+    ~Counted()
+    {
+        --alive;
+    }
+};
+
+template <typename Str>
+concept has_c_str = requires(const Str& str) { str.c_str(); };
+}  // namespace
+
+TEST(StaticVector, NotDefaultConstructible)
+{
+    constexpr auto sum = [] {
+        StaticVector<NotDefaultConstructible, 4> vec;
+        vec.push_back(NotDefaultConstructible(1));
+        vec.push_back(NotDefaultConstructible(2));
+        const auto copy = vec;
+        return copy[0].value + copy.back().value;
+    };
+
+    static_assert(sum() == 3);
+    EXPECT_EQ(sum(), 3);
+}
+
+TEST(StaticVector, ConstructsOnlyItsElements)
+{
+    {
+        StaticVector<Counted, 64> vec;
+        EXPECT_EQ(Counted::alive, 0);
+
+        vec.push_back(Counted());
+        vec.push_back(Counted());
+        EXPECT_EQ(Counted::alive, 2);
+
+        auto copy = vec;
+        EXPECT_EQ(Counted::alive, 4);
+
+        copy = StaticVector<Counted, 64>();
+        EXPECT_EQ(Counted::alive, 2);
+    }
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(StaticVector, CopyAndMove)
+{
+    StaticVector<std::string, 4> vec{"hello", "world"};
+
+    auto copy = vec;
+    EXPECT_EQ(copy, vec);
+
+    const auto moved = std::move(copy);
+    EXPECT_EQ(moved, vec);
+
+    const auto str  = StaticString<char, 1024>("hello"sv);
+    auto       str2 = str;
+    EXPECT_EQ(str2.to_string_view(), "hello"sv);
+    str2 = StaticString<char, 1024>("hi"sv);
+    EXPECT_EQ(str2.to_string_view(), "hi"sv);
+
+    static_assert(std::is_trivially_destructible_v<StaticString<char, 1024>>);
+    // the storage past `size()` is garbage: no NUL terminator to hand out
+    static_assert(!has_c_str<StaticString<char, 1024>>);
+    EXPECT_TRUE(std::equal(vec.rbegin(), vec.rend(), std::array{"world"s, "hello"s}.begin()));
+}
+
+TEST(StaticVector, Append)
+{
+    constexpr auto str = [] {
+        StaticString<char, 16> str("hello"sv);
+        str.append(", "sv);
+        const std::array<char, 5> world{'w', 'o', 'r', 'l', 'd'};
+        str.append(world.begin(), world.end());
+        return str;
+    }();
+
+    static_assert(str.to_string_view() == "hello, world"sv);
+    EXPECT_EQ(str.to_string_view(), "hello, world"sv);
+
+    auto runtime_str = StaticString<char, 16>("hello"sv);
+    runtime_str.append(", world"sv);
+    EXPECT_EQ(runtime_str.to_string_view(), "hello, world"sv);
+
+    // all or nothing
+    EXPECT_THROW(runtime_str.append(" and more"sv), std::range_error);
+    EXPECT_EQ(runtime_str.to_string_view(), "hello, world"sv);
+
+    StaticVector<std::string, 4> strings{"a"};
+    const std::string            more[] = {"b", "c"};
+    strings.append(std::begin(more), std::end(more));
+    EXPECT_EQ(strings.size(), 3);
+    EXPECT_EQ(strings.back(), "c");
+}
+
+TEST(StaticVector, CopyAppendsInBulk)
+{
+    constexpr auto text = "hello, world"sv;
+
+    constexpr auto str = [text] {
+        StaticString<char, 16> str;
+        calgo::copy(text.begin(), text.end(), back_insert_iterator(str));
+        return str;
+    }();
+    static_assert(str.to_string_view() == "hello, world"sv);
+
+    auto runtime_str = StaticString<char, 8>("ab"sv);
+    calgo::copy(text.begin(), text.begin() + 5, back_insert_iterator(runtime_str));
+    EXPECT_EQ(runtime_str.to_string_view(), "abhello"sv);
+    EXPECT_THROW(calgo::copy(text.begin(), text.end(), back_insert_iterator(runtime_str)), std::range_error);
+}
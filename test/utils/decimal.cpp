@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "../../inc/parser_demo"
+
+using namespace d1;
+using namespace std::literals;
+
+namespace
+{
+std::size_t ScalarDigitSpan(std::string_view str)
+{
+    std::size_t count = 0;
+    for (; count != str.size() && str[count] >= '0' && str[count] <= '9'; ++count)
+    {
+    }
+    return count;
+}
+
+template <typename T>
+constexpr StaticString<char, 32> Render(T value)
+{
+    StaticString<char, 32> out;
+    out.append_with([&](char* first, char* last) {
+        if constexpr (std::is_integral_v<T>)
+        {
+            return FormatInteger(first, last, value);
+        }
+        else
+        {
+            return FormatFloat(first, last, value);
+        }
+    });
+    return out;
+}
+
+// the constant evaluation of `FormatFloat()`, run at runtime
+template <typename T>
+std::string Shortest(T value)
+{
+    char buffer[32];
+    return {buffer, d1::utils::decimal::__impl::FormatShortest(buffer, buffer + sizeof(buffer), value)};
+}
+
+template <typename T>
+std::string ToChars(T value)
+{
+    char buffer[32];
+    return {buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr};
+}
+
+template <typename T>
+constexpr StaticString<char, 400> RenderPrecise(T value, std::chars_format format, int precision)
+{
+    StaticString<char, 400> out;
+    out.append_with([&](char* first, char* last) { return FormatFloat(first, last, value, format, precision); });
+    return out;
+}
+
+// the constant evaluation of `FormatFloat(first, last, value, format, precision)`, run at runtime
+template <typename T>
+std::string Precise(T value, std::chars_format format, int precision)
+{
+    char buffer[400];
+    return {buffer,
+            d1::utils::decimal::__impl::FormatPrecise(buffer, buffer + sizeof(buffer), value, format, precision)};
+}
+
+template <typename T>
+std::string ToChars(T value, std::chars_format format, int precision)
+{
+    char buffer[400];
+    return {buffer, std::to_chars(buffer, buffer + sizeof(buffer), value, format, precision).ptr};
+}
+}  // namespace
+
+TEST(Decimal, ConstexprDigitSpan)
+{
+    constexpr auto str = "1234567890123x"sv;
+
+    static_assert(DigitSpan(str.data(), str.data() + str.size()) == 13);
+    static_assert(DigitSpan(str.data(), str.data() + str.size(), 10) == 10);
+    static_assert(DigitSpan(str.data() + 13, str.data() + str.size()) == 0);
+}
+
+TEST(Decimal, ConstexprParseDigits)
+{
+    constexpr auto str = "18446744073709551615"sv;
+
+    static_assert(ParseDigits<std::uint64_t>(str.data(), str.size(), str.data() + str.size()) == 18446744073709551615u);
+    static_assert(ParseDigits<std::uint32_t>(str.data(), 4, str.data() + str.size()) == 1844);
+}
+
+TEST(Decimal, RuntimeDigitSpan)
+{
+    // every digit run length at every alignment, ended by every kind of non-digit or by the end of input
+    const auto terminators = "/:\0 a\x80\xff"s;
+    for (std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (std::size_t len = 0; len <= 24; ++len)
+        {
+            for (const char end : terminators)
+            {
+                const auto str   = std::string(offset, 'x') + std::string(len, '7') + end + "123";
+                const auto first = str.data() + offset;
+
+                EXPECT_EQ(DigitSpan(first, str.data() + str.size()), ScalarDigitSpan(str.substr(offset)));
+                EXPECT_EQ(DigitSpan(first, first + len), len);
+                EXPECT_EQ(DigitSpan(first, str.data() + str.size(), 5), std::min<std::size_t>(len, 5));
+            }
+        }
+    }
+}
+
+TEST(Decimal, RuntimeParseDigits)
+{
+    const auto digits = "98765432109876543210"s;
+    for (std::size_t len = 1; len <= 19; ++len)
+    {
+        const auto str = digits.substr(digits.size() - len);
+
+        EXPECT_EQ(ParseDigits<std::uint64_t>(str.data(), len, str.data() + str.size()), std::stoull(str));
+    }
+}
+
+TEST(Decimal, ConstexprFormatInteger)
+{
+    static_assert(Render(0).to_string_view() == "0"sv);
+    static_assert(Render(-7).to_string_view() == "-7"sv);
+    static_assert(Render(std::int8_t{-128}).to_string_view() == "-128"sv);
+    static_assert(Render(std::numeric_limits<std::int64_t>::min()).to_string_view() == "-9223372036854775808"sv);
+    static_assert(Render(std::numeric_limits<std::uint64_t>::max()).to_string_view() == "18446744073709551615"sv);
+
+    char buffer[4];
+    EXPECT_EQ(FormatInteger(buffer, buffer + 4, 1234), buffer + 4);
+    EXPECT_EQ(FormatInteger(buffer, buffer + 4, -1234), nullptr);
+}
+
+TEST(Decimal, RuntimeFormatInteger)
+{
+    for (std::uint64_t pow = 1; pow <= 1000000000000000000u; pow *= 10)
+    {
+        for (const auto n : {pow - 1, pow, pow + 1, pow * 9 + 7})
+        {
+            EXPECT_EQ(CountDigits(n), std::to_string(n).size());
+            EXPECT_EQ(Render(n).to_string_view(), std::to_string(n));
+            const auto negative = -static_cast<std::int64_t>(n);
+            EXPECT_EQ(Render(negative).to_string_view(), std::to_string(negative));
+        }
+    }
+}
+
+TEST(Decimal, ConstexprFormatFloat)
+{
+    static_assert(Render(0.0).to_string_view() == "0"sv);
+    static_assert(Render(-0.0).to_string_view() == "-0"sv);
+    static_assert(Render(0.1).to_string_view() == "0.1"sv);
+    static_assert(Render(-2.5).to_string_view() == "-2.5"sv);
+    static_assert(Render(100.0).to_string_view() == "100"sv);
+    static_assert(Render(123456.0).to_string_view() == "123456"sv);
+    static_assert(Render(1.0 / 3).to_string_view() == "0.3333333333333333"sv);
+    static_assert(Render(1e22).to_string_view() == "1e+22"sv);
+    static_assert(Render(1e-5).to_string_view() == "1e-05"sv);
+    static_assert(Render(5e-324).to_string_view() == "5e-324"sv);
+    static_assert(Render(std::numeric_limits<double>::max()).to_string_view() == "1.7976931348623157e+308"sv);
+    static_assert(Render(0.3f).to_string_view() == "0.3"sv);
+    static_assert(Render(std::numeric_limits<double>::infinity()).to_string_view() == "inf"sv);
+    static_assert(Render(-std::numeric_limits<float>::infinity()).to_string_view() == "-inf"sv);
+}
+
+TEST(Decimal, ShortestMatchesToChars)
+{
+    // every bit pattern is as likely: all the exponents, the subnormals and the powers of 2 are covered
+    auto random = std::mt19937_64(0x5EED);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto bits = random();
+        const auto d    = std::bit_cast<double>(bits);
+        const auto f    = std::bit_cast<float>(static_cast<std::uint32_t>(bits));
+
+        EXPECT_EQ(Shortest(d), ToChars(d));
+        EXPECT_EQ(Shortest(f), ToChars(f));
+    }
+    for (int exp = -1074; exp <= 1023; ++exp)
+    {
+        const auto pow2 = std::ldexp(1.0, exp);
+        EXPECT_EQ(Shortest(pow2), ToChars(pow2));
+    }
+    for (double d = 1e-7; d < 1e23; d *= 10)
+    {
+        EXPECT_EQ(Shortest(d), ToChars(d));
+        EXPECT_EQ(Shortest(d * 1.5), ToChars(d * 1.5));
+    }
+}
+
+TEST(Decimal, FormatIntegerInBase)
+{
+    static_assert(CountDigits(0, 16) == 1 && CountDigits(255, 16) == 2 && CountDigits(256, 16) == 3);
+    static_assert(CountDigits(8, 8) == 2 && CountDigits(std::numeric_limits<std::uint64_t>::max(), 2) == 64);
+
+    char buffer[64];
+    WriteDigits(buffer, 0xBEEF, 6, 16, true);
+    EXPECT_EQ(std::string_view(buffer, 6), "00BEEF"sv);
+    WriteDigits(buffer, 5, 4, 2);
+    EXPECT_EQ(std::string_view(buffer, 4), "0101"sv);
+    WriteDigits(buffer, 1234, 5, 10);
+    EXPECT_EQ(std::string_view(buffer, 5), "01234"sv);
+}
+
+TEST(Decimal, ConstexprFormatPrecise)
+{
+    using enum std::chars_format;
+
+    static_assert(RenderPrecise(3.14159, fixed, 3).to_string_view() == "3.142"sv);
+    static_assert(RenderPrecise(2.5, fixed, 0).to_string_view() == "2"sv);
+    static_assert(RenderPrecise(0.125, fixed, 2).to_string_view() == "0.12"sv);
+    static_assert(RenderPrecise(-0.0, fixed, 1).to_string_view() == "-0.0"sv);
+    static_assert(RenderPrecise(9.9996, scientific, 3).to_string_view() == "1.000e+01"sv);
+    static_assert(RenderPrecise(0.0, scientific, 2).to_string_view() == "0.00e+00"sv);
+    static_assert(RenderPrecise(1e-300, scientific, 0).to_string_view() == "1e-300"sv);
+    static_assert(RenderPrecise(1234567.0, general, 3).to_string_view() == "1.23e+06"sv);
+    static_assert(RenderPrecise(0.0001, general, 6).to_string_view() == "0.0001"sv);
+    static_assert(RenderPrecise(100.0, general, 0).to_string_view() == "1e+02"sv);
+    static_assert(RenderPrecise(1.5f, general, 6).to_string_view() == "1.5"sv);
+    static_assert(RenderPrecise(-std::numeric_limits<double>::infinity(), fixed, 2).to_string_view() == "-inf"sv);
+
+    char buffer[4];
+    EXPECT_EQ(FormatFloat(buffer, buffer + 4, 1.5, fixed, 2), buffer + 4);
+    EXPECT_EQ(FormatFloat(buffer, buffer + 4, 1.5, fixed, 3), nullptr);
+}
+
+TEST(Decimal, PreciseMatchesToChars)
+{
+    using enum std::chars_format;
+
+    auto random = std::mt19937_64(0x5EED);
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto bits      = random();
+        const auto d         = std::bit_cast<double>(bits);
+        const auto f         = std::bit_cast<float>(static_cast<std::uint32_t>(bits));
+        const auto precision = static_cast<int>(bits >> 58);
+        for (const auto format : {fixed, scientific, general})
+        {
+            EXPECT_EQ(Precise(d, format, precision), ToChars(d, format, precision));
+            EXPECT_EQ(Precise(f, format, precision), ToChars(f, format, precision));
+        }
+    }
+    for (double d = 1e-7; d < 1e23; d *= 10)
+    {
+        for (int precision = 0; precision < 20; ++precision)
+        {
+            for (const auto format : {fixed, scientific, general})
+            {
+                EXPECT_EQ(Precise(d * 1.5, format, precision), ToChars(d * 1.5, format, precision));
+                EXPECT_EQ(Precise(d * 0.5, format, precision), ToChars(d * 0.5, format, precision));
+            }
+        }
+    }
+    EXPECT_EQ(Precise(std::numeric_limits<double>::max(), fixed, 64),
+              ToChars(std::numeric_limits<double>::max(), fixed, 64));
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include <memory>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <sys/cdefs.h>
 #include <variant>
 
@@ -118,4 +121,37 @@ TEST(OptionContinuation, MultiContinuation)
 
     static_assert(cint_3.is_some());
     static_assert(cint_3 == SOME(3));
-}
\ No newline at end of file
+}
+
+TEST(OptionUnwrap, Unchecked)
+{
+    constexpr Option cint_1 = SOME(1);
+
+    static_assert(cint_1.unwrap_unchecked() == 1);
+    static_assert(noexcept(cint_1.unwrap_unchecked()));
+}
+
+TEST(OptionUnwrap, ByReference)
+{
+    const Option str = SOME(std::string("345"));
+
+    EXPECT_EQ(std::addressof(str.unwrap()), std::addressof(str.unwrap_unchecked()));
+    EXPECT_EQ(SOME(std::string("345")).unwrap(), std::string("345"));
+}
+
+TEST(OptionLayout, FlagAndStorage)
+{
+    // no `std::variant` inside, trivial payloads keep `Option` trivial to copy and destroy.
+    static_assert(sizeof(Option<int>) == sizeof(std::optional<int>));
+    static_assert(sizeof(ParserOutput<char>) == sizeof(std::optional<std::pair<char, ParserInput>>));
+    static_assert(std::is_trivially_copy_constructible_v<ParserOutput<std::string_view>>);
+    static_assert(std::is_trivially_destructible_v<ParserOutput<std::string_view>>);
+}
+
+TEST(OptionContinuation, Variant)
+{
+    constexpr Option cint_1 = SOME(1);
+
+    static_assert(std::holds_alternative<Some<int>>(cint_1.to_variant()));
+    static_assert(std::holds_alternative<None>(Option<int>(NONE).to_variant()));
+}